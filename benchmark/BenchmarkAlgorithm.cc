@@ -0,0 +1,212 @@
+/**
+ *  @file   benchmark/BenchmarkAlgorithm.cc
+ *
+ *  @brief  Implementation of the benchmark algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerToolsT.h"
+
+#include "benchmark/BenchmarkAlgorithm.h"
+#include "benchmark/SyntheticEventGenerator.h"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+BenchmarkAlgorithm::BenchmarkAlgorithm() :
+    m_slidingFitWindow(20),
+    m_kdTreeSearchRegion1D(2.f),
+    m_bdtName("SyntheticBdt"),
+    m_nSyntheticBdtTrees(0),
+    m_syntheticBdtTreeDepth(4),
+    m_syntheticBdtSeed(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BenchmarkAlgorithm::Initialize()
+{
+    if (m_bdtFileName.empty())
+        return STATUS_CODE_SUCCESS;
+
+    if (m_nSyntheticBdtTrees > 0)
+    {
+        // ATTN The synthetic bdt cuts on the features calculated in BenchmarkBdt, with cut values drawn from these ranges
+        const FloatVector featureRanges{1000.f, 300.f, 1000.f, 1.f};
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            SyntheticEventGenerator::WriteBdtFile(
+                m_bdtFileName, m_bdtName, m_syntheticBdtSeed, m_nSyntheticBdtTrees, m_syntheticBdtTreeDepth, featureRanges));
+    }
+
+    return m_adaBoostDecisionTree.Initialize(m_bdtFileName, m_bdtName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BenchmarkAlgorithm::Run()
+{
+    if (!m_pAlgorithmProfiler)
+        m_pAlgorithmProfiler = std::make_unique<AlgorithmProfiler>(m_instanceLabel, m_outputFileName);
+
+    m_pAlgorithmProfiler->BeginEvent();
+
+    for (const std::string &clusterListName : m_clusterListNames)
+    {
+        const ClusterList *pClusterList(nullptr);
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*this, clusterListName, pClusterList));
+
+        if (!pClusterList || pClusterList->empty())
+            continue;
+
+        ClusterVector clusterVector(pClusterList->begin(), pClusterList->end());
+        std::sort(clusterVector.begin(), clusterVector.end(), LArClusterHelper::SortByNHits);
+
+        this->BenchmarkSlidingFits(clusterVector);
+        this->BenchmarkClusterDistances(clusterVector);
+        this->BenchmarkKDTree(clusterVector);
+
+        if (!m_bdtFileName.empty())
+            this->BenchmarkBdt(clusterVector);
+    }
+
+    return m_pAlgorithmProfiler->WriteEvent();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkAlgorithm::BenchmarkSlidingFits(const ClusterVector &clusterVector) const
+{
+    const HitType hitType(LArClusterHelper::GetClusterHitType(clusterVector.front()));
+    const float slidingFitPitch(LArGeometryHelper::GetWirePitch(this->GetPandora(), hitType));
+    const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), "TwoDSlidingFitResult");
+
+    for (const Cluster *const pCluster : clusterVector)
+    {
+        try
+        {
+            const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+            (void)slidingFitResult;
+        }
+        catch (const StatusCodeException &)
+        {
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkAlgorithm::BenchmarkClusterDistances(const ClusterVector &clusterVector) const
+{
+    const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), "LArClusterHelper::GetClosestDistance");
+
+    for (ClusterVector::const_iterator iter1 = clusterVector.begin(), iterEnd = clusterVector.end(); iter1 != iterEnd; ++iter1)
+    {
+        for (ClusterVector::const_iterator iter2 = std::next(iter1); iter2 != iterEnd; ++iter2)
+            (void)LArClusterHelper::GetClosestDistance(*iter1, *iter2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkAlgorithm::BenchmarkKDTree(const ClusterVector &clusterVector) const
+{
+    CaloHitList caloHitList;
+
+    for (const Cluster *const pCluster : clusterVector)
+        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    HitKDTree2D kdTree;
+    HitKDNode2DList hitKDNode2DList;
+
+    {
+        const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), "KDTreeLinkerAlgo::build");
+        KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(caloHitList, hitKDNode2DList));
+        kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    }
+
+    {
+        const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), "KDTreeLinkerAlgo::search");
+
+        for (const CaloHit *const pCaloHit : caloHitList)
+        {
+            KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_kdTreeSearchRegion1D, m_kdTreeSearchRegion1D));
+
+            HitKDNode2DList found;
+            kdTree.search(searchRegionHits, found);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkAlgorithm::BenchmarkBdt(const ClusterVector &clusterVector) const
+{
+    std::vector<LArMvaHelper::MvaFeatureVector> featureVectors;
+
+    for (const Cluster *const pCluster : clusterVector)
+    {
+        LArMvaHelper::MvaFeatureVector featureVector;
+        featureVector.emplace_back(static_cast<double>(pCluster->GetNCaloHits()));
+        featureVector.emplace_back(static_cast<double>(LArClusterHelper::GetLength(pCluster)));
+        featureVector.emplace_back(static_cast<double>(LArClusterHelper::GetLayerSpan(pCluster)));
+        featureVector.emplace_back(static_cast<double>(LArClusterHelper::GetLayerOccupancy(pCluster)));
+        featureVectors.push_back(featureVector);
+    }
+
+    const AlgorithmProfiler::ScopedMeasurement measurement(
+        m_pAlgorithmProfiler.get(), "AdaBoostDecisionTree::CalculateClassificationScore");
+
+    for (const LArMvaHelper::MvaFeatureVector &featureVector : featureVectors)
+        (void)m_adaBoostDecisionTree.CalculateClassificationScore(featureVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BenchmarkAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "ClusterListNames", m_clusterListNames));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputFileName", m_outputFileName));
+
+    m_instanceLabel = this->GetInstanceName();
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InstanceLabel", m_instanceLabel));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SlidingFitWindow", m_slidingFitWindow));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "KDTreeSearchRegion1D", m_kdTreeSearchRegion1D));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "BdtFileName", m_bdtFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "BdtName", m_bdtName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSyntheticBdtTrees", m_nSyntheticBdtTrees));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SyntheticBdtTreeDepth", m_syntheticBdtTreeDepth));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SyntheticBdtSeed", m_syntheticBdtSeed));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
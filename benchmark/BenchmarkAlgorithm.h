@@ -0,0 +1,104 @@
+/**
+ *  @file   benchmark/BenchmarkAlgorithm.h
+ *
+ *  @brief  Header file for the benchmark algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_BENCHMARK_ALGORITHM_H
+#define LAR_BENCHMARK_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+
+#include "larpandoracontent/LArUtility/AlgorithmProfiler.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <memory>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  BenchmarkAlgorithm class, timing the sliding fits, cluster distances, hit kd tree searches and bdt evaluations for the clusters
+ *          in a set of named lists, with the records for each event appended to an output file
+ */
+class BenchmarkAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public pandora::AlgorithmFactory
+    {
+    public:
+        pandora::Algorithm *CreateAlgorithm() const;
+    };
+
+    /**
+     *  @brief  Default constructor
+     */
+    BenchmarkAlgorithm();
+
+private:
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
+    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+
+    pandora::StatusCode Initialize();
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Time the sliding linear fits to the clusters
+     *
+     *  @param  clusterVector the clusters, all from a single view
+     */
+    void BenchmarkSlidingFits(const pandora::ClusterVector &clusterVector) const;
+
+    /**
+     *  @brief  Time the calculation of the closest distance between each pair of clusters
+     *
+     *  @param  clusterVector the clusters, all from a single view
+     */
+    void BenchmarkClusterDistances(const pandora::ClusterVector &clusterVector) const;
+
+    /**
+     *  @brief  Time the construction of a kd tree of the cluster hits, and a search of the region around each hit
+     *
+     *  @param  clusterVector the clusters, all from a single view
+     */
+    void BenchmarkKDTree(const pandora::ClusterVector &clusterVector) const;
+
+    /**
+     *  @brief  Time the bdt evaluation for each cluster
+     *
+     *  @param  clusterVector the clusters, all from a single view
+     */
+    void BenchmarkBdt(const pandora::ClusterVector &clusterVector) const;
+
+    pandora::StringVector m_clusterListNames;                ///< The names of the cluster lists, each for a single view
+    std::string m_outputFileName;                            ///< The name of the output file, to which records are appended
+    std::string m_instanceLabel;                             ///< The label identifying this instance in the output file
+    unsigned int m_slidingFitWindow;                         ///< The layer window for the sliding linear fits
+    float m_kdTreeSearchRegion1D;                            ///< The half-width of the kd tree search region around each hit, units cm
+    std::string m_bdtFileName;                               ///< The name of the bdt file, or empty to skip the bdt evaluations
+    std::string m_bdtName;                                   ///< The name of the bdt
+    unsigned int m_nSyntheticBdtTrees;                       ///< The number of trees for a synthetic bdt written to the bdt file, or zero
+    unsigned int m_syntheticBdtTreeDepth;                    ///< The depth of each tree in the synthetic bdt
+    unsigned int m_syntheticBdtSeed;                         ///< The seed for the random cuts in the synthetic bdt
+    AdaBoostDecisionTree m_adaBoostDecisionTree;             ///< The bdt
+    std::unique_ptr<AlgorithmProfiler> m_pAlgorithmProfiler; ///< The algorithm profiler, created when the first event is processed
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::Algorithm *BenchmarkAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new BenchmarkAlgorithm();
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_BENCHMARK_ALGORITHM_H
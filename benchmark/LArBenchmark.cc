@@ -0,0 +1,238 @@
+/**
+ *  @file   benchmark/LArBenchmark.cc
+ *
+ *  @brief  Implementation of the lar benchmark application, reconstructing seeded synthetic events and reporting the timings.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/Pandora.h"
+
+#include "larpandoracontent/LArContent.h"
+
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
+#include "benchmark/BenchmarkAlgorithm.h"
+#include "benchmark/SyntheticEventGenerator.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace
+{
+
+/**
+ *  @brief  Parameters class
+ */
+class Parameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Parameters();
+
+    std::string m_settingsFile;                            ///< The pandora settings file
+    unsigned int m_nEvents;                                ///< The number of events to process
+    SyntheticEventGenerator::Settings m_generatorSettings; ///< The synthetic event generator settings
+};
+
+/**
+ *  @brief  Parse the command line arguments, setting the application parameters
+ *
+ *  @param  argc argument count
+ *  @param  argv argument vector
+ *  @param  parameters to receive the application parameters
+ *
+ *  @return whether the benchmark should proceed
+ */
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters);
+
+/**
+ *  @brief  Print the list of configurable options
+ *
+ *  @return false, to force abort
+ */
+bool PrintOptions();
+
+/**
+ *  @brief  Create and configure the pandora instance, ready to process events
+ *
+ *  @param  parameters the application parameters
+ *  @param  generator the synthetic event generator
+ *
+ *  @return the pandora instance
+ */
+std::unique_ptr<const Pandora> CreatePandoraInstance(const Parameters &parameters, const SyntheticEventGenerator &generator);
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        Parameters parameters;
+
+        if (!ParseCommandLine(argc, argv, parameters))
+            return 1;
+
+        SyntheticEventGenerator generator(parameters.m_generatorSettings);
+        const std::unique_ptr<const Pandora> pPandora(CreatePandoraInstance(parameters, generator));
+
+        double totalTime(0.);
+        unsigned int totalHits(0);
+
+        for (unsigned int eventNumber = 0; eventNumber < parameters.m_nEvents; ++eventNumber)
+        {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, generator.CreateEvent(*pPandora, eventNumber));
+
+            const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandora));
+            const std::chrono::duration<double> eventTime(std::chrono::steady_clock::now() - startTime);
+
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPandora));
+
+            totalTime += eventTime.count();
+            totalHits += generator.GetNHits();
+            std::cout << "LArBenchmark: event " << eventNumber << ", " << generator.GetNHits() << " hits, " << eventTime.count() << " s"
+                      << std::endl;
+        }
+
+        if (parameters.m_nEvents > 0)
+        {
+            std::cout << "LArBenchmark: " << parameters.m_nEvents << " events, mean " << totalHits / parameters.m_nEvents << " hits, mean "
+                      << totalTime / parameters.m_nEvents << " s per event" << std::endl;
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cerr << "LArBenchmark: exception caught " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+Parameters::Parameters() :
+    m_nEvents(10)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters)
+{
+    if (1 == argc)
+        return PrintOptions();
+
+    SyntheticEventGenerator::Settings &settings(parameters.m_generatorSettings);
+    int cOpt(0);
+
+    try
+    {
+        while ((cOpt = getopt(argc, argv, "i:n:s:t:k:e:c:h")) != -1)
+        {
+            switch (cOpt)
+            {
+                case 'i':
+                    parameters.m_settingsFile = optarg;
+                    break;
+                case 'n':
+                    parameters.m_nEvents = std::stoul(optarg);
+                    break;
+                case 's':
+                    settings.m_seed = std::stoul(optarg);
+                    break;
+                case 't':
+                    settings.m_nTPCs = std::stoul(optarg);
+                    break;
+                case 'k':
+                    settings.m_nTracks = std::stoul(optarg);
+                    break;
+                case 'e':
+                    settings.m_nShowers = std::stoul(optarg);
+                    break;
+                case 'c':
+                    settings.m_nCosmics = std::stoul(optarg);
+                    break;
+                case 'h':
+                default:
+                    return PrintOptions();
+            }
+        }
+    }
+    catch (const std::logic_error &)
+    {
+        std::cout << "LArBenchmark: invalid numerical argument" << std::endl;
+        return PrintOptions();
+    }
+
+    if (parameters.m_settingsFile.empty())
+    {
+        std::cout << "LArBenchmark: a pandora settings file must be provided" << std::endl;
+        return PrintOptions();
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PrintOptions()
+{
+    const SyntheticEventGenerator::Settings settings;
+
+    std::cout << std::endl
+              << "./LArBenchmark " << std::endl
+              << "    -i PandoraSettings.xml  (required) [algorithm description, e.g. benchmark/PandoraSettings_Benchmark.xml]" << std::endl
+              << "    -n NEventsToProcess     (optional) [default " << Parameters().m_nEvents << "]" << std::endl
+              << "    -s Seed                 (optional) [default " << settings.m_seed << "]" << std::endl
+              << "    -t NTPCs                (optional) [default " << settings.m_nTPCs << "]" << std::endl
+              << "    -k NTracksPerEvent      (optional) [default " << settings.m_nTracks << "]" << std::endl
+              << "    -e NShowersPerEvent     (optional) [default " << settings.m_nShowers << "]" << std::endl
+              << "    -c NCosmicsPerEvent     (optional) [default " << settings.m_nCosmics << "]" << std::endl
+              << std::endl;
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::unique_ptr<const Pandora> CreatePandoraInstance(const Parameters &parameters, const SyntheticEventGenerator &generator)
+{
+    std::unique_ptr<const Pandora> pPandora(std::make_unique<const Pandora>("LArBenchmark"));
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new LArPseudoLayerPlugin));
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new LArRotationalTransformationPlugin));
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "LArBenchmark", new BenchmarkAlgorithm::Factory));
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, generator.CreateGeometry(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, parameters.m_settingsFile));
+
+    return pPandora;
+}
+
+} // namespace
@@ -0,0 +1,491 @@
+/**
+ *  @file   benchmark/SyntheticEventGenerator.cc
+ *
+ *  @brief  Implementation of the synthetic event generator class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
+#include "benchmark/SyntheticEventGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+SyntheticEventGenerator::Settings::Settings() :
+    m_seed(0),
+    m_nTPCs(2),
+    m_tpcWidthX(250.f),
+    m_tpcWidthY(250.f),
+    m_tpcWidthZ(500.f),
+    m_wirePitch(0.3f),
+    m_wireAngleUV(M_PI / 3.f),
+    m_nTracks(3),
+    m_nShowers(2),
+    m_nCosmics(10),
+    m_stepLength(0.3f),
+    m_maxCosmicOffsetX(20.f),
+    m_mipEnergyLoss(0.0021f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SyntheticEventGenerator::SyntheticEventGenerator(const Settings &settings) :
+    m_settings(settings),
+    m_minX(-0.5f * static_cast<float>(settings.m_nTPCs) * settings.m_tpcWidthX)
+{
+    const float epsilon(std::numeric_limits<float>::epsilon());
+
+    if ((0 == m_settings.m_nTPCs) || (m_settings.m_tpcWidthX < epsilon) || (m_settings.m_wirePitch < epsilon) ||
+        (m_settings.m_stepLength < epsilon))
+    {
+        std::cout << "SyntheticEventGenerator: invalid settings" << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SyntheticEventGenerator::CreateGeometry(const Pandora &pandora) const
+{
+    for (unsigned int tpcIndex = 0; tpcIndex < m_settings.m_nTPCs; ++tpcIndex)
+    {
+        PandoraApi::Geometry::LArTPC::Parameters parameters;
+        parameters.m_larTPCVolumeId = tpcIndex;
+        parameters.m_centerX = m_minX + (static_cast<float>(tpcIndex) + 0.5f) * m_settings.m_tpcWidthX;
+        parameters.m_centerY = 0.f;
+        parameters.m_centerZ = 0.5f * m_settings.m_tpcWidthZ;
+        parameters.m_widthX = m_settings.m_tpcWidthX;
+        parameters.m_widthY = m_settings.m_tpcWidthY;
+        parameters.m_widthZ = m_settings.m_tpcWidthZ;
+        parameters.m_wirePitchU = m_settings.m_wirePitch;
+        parameters.m_wirePitchV = m_settings.m_wirePitch;
+        parameters.m_wirePitchW = m_settings.m_wirePitch;
+        parameters.m_wireAngleU = m_settings.m_wireAngleUV;
+        parameters.m_wireAngleV = -m_settings.m_wireAngleUV;
+        parameters.m_wireAngleW = 0.f;
+        parameters.m_sigmaUVW = 1.f;
+        // ATTN Neighbouring tpcs share either a cathode or an anode, so drift directions alternate
+        parameters.m_isDriftInPositiveX = (1 == tpcIndex % 2);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LArTPC::Create(pandora, parameters));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SyntheticEventGenerator::CreateEvent(const Pandora &pandora, const unsigned int eventNumber)
+{
+    // ATTN Each event is seeded independently, so it is reproducible whatever the order in which events are created
+    std::seed_seq seedSequence{m_settings.m_seed, eventNumber};
+    RandomEngine randomEngine(seedSequence);
+
+    m_particleVector.clear();
+    m_hitVector.clear();
+
+    this->GenerateInteraction(randomEngine);
+
+    for (unsigned int iCosmic = 0; iCosmic < m_settings.m_nCosmics; ++iCosmic)
+        this->GenerateCosmicRay(randomEngine);
+
+    this->GenerateHits(pandora, randomEngine);
+
+    // ATTN The particle and hit vectors are now complete, so the addresses of their elements can be used as parent addresses
+    for (const SyntheticParticle &particle : m_particleVector)
+    {
+        const float mass(SyntheticEventGenerator::GetMass(particle.m_particleId));
+        const float momentum(std::sqrt(std::max(0.f, particle.m_energy * particle.m_energy - mass * mass)));
+
+        LArMCParticleParameters parameters;
+        parameters.m_nuanceCode = particle.m_nuanceCode;
+        parameters.m_process = particle.m_process;
+        parameters.m_energy = particle.m_energy;
+        parameters.m_momentum = particle.m_direction * momentum;
+        parameters.m_vertex = particle.m_vertex;
+        parameters.m_endpoint = particle.m_trajectory.empty() ? particle.m_vertex : particle.m_trajectory.back();
+        parameters.m_particleId = particle.m_particleId;
+        parameters.m_mcParticleType = MC_3D;
+        parameters.m_pParentAddress = static_cast<const void *>(&particle);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(pandora, parameters, m_mcParticleFactory));
+    }
+
+    for (const SyntheticParticle &particle : m_particleVector)
+    {
+        if (particle.m_parentIndex < 0)
+            continue;
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetMCParentDaughterRelationship(pandora, &m_particleVector.at(particle.m_parentIndex), &particle));
+    }
+
+    const float mipEnergy(m_settings.m_mipEnergyLoss * m_settings.m_stepLength);
+
+    for (const SyntheticHit &hit : m_hitVector)
+    {
+        LArCaloHitParameters parameters;
+        parameters.m_positionVector = hit.m_position;
+        parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellGeometry = RECTANGULAR;
+        parameters.m_cellSize0 = m_settings.m_wirePitch;
+        parameters.m_cellSize1 = m_settings.m_wirePitch;
+        parameters.m_cellThickness = m_settings.m_wirePitch;
+        parameters.m_nCellRadiationLengths = 1.f;
+        parameters.m_nCellInteractionLengths = 1.f;
+        parameters.m_time = 0.f;
+        parameters.m_inputEnergy = hit.m_mipEquivalentEnergy * mipEnergy;
+        parameters.m_mipEquivalentEnergy = hit.m_mipEquivalentEnergy;
+        parameters.m_electromagneticEnergy = hit.m_mipEquivalentEnergy * mipEnergy;
+        parameters.m_hadronicEnergy = hit.m_mipEquivalentEnergy * mipEnergy;
+        parameters.m_isDigital = false;
+        parameters.m_hitType = hit.m_hitType;
+        parameters.m_hitRegion = SINGLE_REGION;
+        parameters.m_layer = 0;
+        parameters.m_isInOuterSamplingLayer = false;
+        parameters.m_pParentAddress = static_cast<const void *>(&hit);
+        parameters.m_larTPCVolumeId = hit.m_larTPCVolumeId;
+        parameters.m_daughterVolumeId = 0;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters, m_caloHitFactory));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetCaloHitToMCParticleRelationship(pandora, &hit, &m_particleVector.at(hit.m_particleIndex), 1.f));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SyntheticEventGenerator::WriteBdtFile(const std::string &fileName, const std::string &bdtName, const unsigned int seed,
+    const unsigned int nTrees, const unsigned int treeDepth, const FloatVector &featureRanges)
+{
+    if (featureRanges.empty() || (0 == treeDepth) || (treeDepth > 16))
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    std::ofstream outputFile(fileName);
+
+    if (!outputFile.good())
+    {
+        std::cout << "SyntheticEventGenerator: unable to open bdt file " << fileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    RandomEngine randomEngine(seed);
+    std::uniform_int_distribution<unsigned int> variableIdDistribution(0, featureRanges.size() - 1);
+    std::uniform_real_distribution<float> unitDistribution(0.f, 1.f);
+    std::bernoulli_distribution outcomeDistribution(0.5);
+
+    // ATTN Each tree is complete, with nodes numbered such that the children of node n are nodes 2n + 1 and 2n + 2
+    const int nBranchNodes((1 << treeDepth) - 1), nNodes((1 << (treeDepth + 1)) - 1);
+
+    outputFile << "<AdaBoostDecisionTree>" << std::endl;
+    outputFile << "    <Name>" << bdtName << "</Name>" << std::endl;
+
+    for (unsigned int treeIndex = 0; treeIndex < nTrees; ++treeIndex)
+    {
+        outputFile << "    <DecisionTree>" << std::endl;
+        outputFile << "        <TreeIndex>" << treeIndex << "</TreeIndex>" << std::endl;
+        outputFile << "        <TreeWeight>" << 0.1f + unitDistribution(randomEngine) << "</TreeWeight>" << std::endl;
+
+        for (int nodeId = 0; nodeId < nNodes; ++nodeId)
+        {
+            outputFile << "        <Node>" << std::endl;
+            outputFile << "            <NodeId>" << nodeId << "</NodeId>" << std::endl;
+            outputFile << "            <ParentNodeId>" << ((0 == nodeId) ? -1 : (nodeId - 1) / 2) << "</ParentNodeId>" << std::endl;
+
+            if (nodeId < nBranchNodes)
+            {
+                const unsigned int variableId(variableIdDistribution(randomEngine));
+                const float threshold(unitDistribution(randomEngine) * featureRanges.at(variableId));
+                outputFile << "            <LeftChildNodeId>" << 2 * nodeId + 1 << "</LeftChildNodeId>" << std::endl;
+                outputFile << "            <RightChildNodeId>" << 2 * nodeId + 2 << "</RightChildNodeId>" << std::endl;
+                outputFile << "            <Threshold>" << threshold << "</Threshold>" << std::endl;
+                outputFile << "            <VariableId>" << variableId << "</VariableId>" << std::endl;
+            }
+            else
+            {
+                const bool outcome(outcomeDistribution(randomEngine));
+                outputFile << "            <Outcome>" << (outcome ? "true" : "false") << "</Outcome>" << std::endl;
+            }
+
+            outputFile << "        </Node>" << std::endl;
+        }
+
+        outputFile << "    </DecisionTree>" << std::endl;
+    }
+
+    outputFile << "</AdaBoostDecisionTree>" << std::endl;
+
+    return (outputFile.good() ? STATUS_CODE_SUCCESS : STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerator::GenerateInteraction(RandomEngine &randomEngine)
+{
+    if ((0 == m_settings.m_nTracks) && (0 == m_settings.m_nShowers))
+        return;
+
+    // ATTN Keep the vertex away from the detector boundaries, so that most of each interaction is contained
+    std::uniform_real_distribution<float> vertexXDistribution(0.9f * m_minX, -0.9f * m_minX);
+    std::uniform_real_distribution<float> vertexYDistribution(-0.4f * m_settings.m_tpcWidthY, 0.4f * m_settings.m_tpcWidthY);
+    std::uniform_real_distribution<float> vertexZDistribution(0.1f * m_settings.m_tpcWidthZ, 0.9f * m_settings.m_tpcWidthZ);
+    const CartesianVector vertex(vertexXDistribution(randomEngine), vertexYDistribution(randomEngine), vertexZDistribution(randomEngine));
+
+    const int neutrinoIndex(static_cast<int>(m_particleVector.size()));
+    m_particleVector.emplace_back(14, MC_PROC_INCIDENT_NU, -1, vertex, CartesianVector(0.f, 0.f, 1.f));
+    m_particleVector.back().m_nuanceCode = 1001;
+
+    std::uniform_real_distribution<float> muonLengthDistribution(50.f, 300.f), protonLengthDistribution(2.f, 40.f);
+
+    for (unsigned int iTrack = 0; iTrack < m_settings.m_nTracks; ++iTrack)
+    {
+        // ATTN The first track is a muon and any others are protons
+        const bool isMuon(0 == iTrack);
+        const CartesianVector direction(SyntheticEventGenerator::GetRandomDirection(randomEngine));
+        const float length(isMuon ? muonLengthDistribution(randomEngine) : protonLengthDistribution(randomEngine));
+        m_particleVector.emplace_back(isMuon ? 13 : 2212, MC_PROC_PRIMARY, neutrinoIndex, vertex, direction);
+
+        SyntheticParticle &track(m_particleVector.back());
+        track.m_dEdx = isMuon ? 1.f : 3.f;
+        this->Propagate(track, length, isMuon ? 0.005f : 0.01f, randomEngine);
+    }
+
+    for (unsigned int iShower = 0; iShower < m_settings.m_nShowers; ++iShower)
+        this->GenerateShower(neutrinoIndex, vertex, SyntheticEventGenerator::GetRandomDirection(randomEngine), randomEngine);
+
+    float neutrinoEnergy(0.f);
+
+    for (const SyntheticParticle &particle : m_particleVector)
+    {
+        if (neutrinoIndex == particle.m_parentIndex)
+            neutrinoEnergy += particle.m_energy;
+    }
+
+    m_particleVector.at(neutrinoIndex).m_energy = neutrinoEnergy;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerator::GenerateShower(
+    const int parentIndex, const CartesianVector &vertex, const CartesianVector &direction, RandomEngine &randomEngine)
+{
+    const int trunkIndex(static_cast<int>(m_particleVector.size()));
+    m_particleVector.emplace_back(11, MC_PROC_PRIMARY, parentIndex, vertex, direction);
+
+    std::uniform_real_distribution<float> trunkLengthDistribution(3.f, 10.f);
+    this->Propagate(m_particleVector.back(), trunkLengthDistribution(randomEngine), 0.05f, randomEngine);
+
+    const CartesianVector trunkEnd(m_particleVector.back().m_trajectory.empty() ? vertex : m_particleVector.back().m_trajectory.back());
+
+    // ATTN Branches start at exponentially distributed distances along the shower axis, beyond the trunk, as for converted photons
+    std::uniform_int_distribution<unsigned int> nBranchesDistribution(10, 30);
+    std::exponential_distribution<float> branchStartDistribution(0.1f), branchLengthDistribution(0.25f);
+    const unsigned int nBranches(nBranchesDistribution(randomEngine));
+
+    for (unsigned int iBranch = 0; iBranch < nBranches; ++iBranch)
+    {
+        const CartesianVector branchVertex(trunkEnd + direction * branchStartDistribution(randomEngine));
+        m_particleVector.emplace_back(
+            11, MC_PROC_COMPT, trunkIndex, branchVertex, SyntheticEventGenerator::Deflect(direction, 0.3f, randomEngine));
+        this->Propagate(m_particleVector.back(), branchLengthDistribution(randomEngine), 0.2f, randomEngine);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerator::GenerateCosmicRay(RandomEngine &randomEngine)
+{
+    // ATTN Cosmic rays enter through the top of the detector, with the cosine of the zenith angle uniform between 0.3 and 1
+    std::uniform_real_distribution<float> entryXDistribution(m_minX, -m_minX), entryZDistribution(0.f, m_settings.m_tpcWidthZ);
+    std::uniform_real_distribution<float> cosZenithDistribution(0.3f, 1.f), azimuthDistribution(0.f, 2.f * M_PI);
+    std::uniform_real_distribution<float> offsetXDistribution(-m_settings.m_maxCosmicOffsetX, m_settings.m_maxCosmicOffsetX);
+
+    const CartesianVector entryPoint(entryXDistribution(randomEngine), 0.5f * m_settings.m_tpcWidthY, entryZDistribution(randomEngine));
+    const float cosZenith(cosZenithDistribution(randomEngine)), sinZenith(std::sqrt(1.f - cosZenith * cosZenith));
+    const float azimuth(azimuthDistribution(randomEngine));
+    const CartesianVector direction(sinZenith * std::cos(azimuth), -cosZenith, sinZenith * std::sin(azimuth));
+
+    m_particleVector.emplace_back(13, MC_PROC_PRIMARY, -1, entryPoint, direction);
+
+    SyntheticParticle &cosmicRay(m_particleVector.back());
+    cosmicRay.m_offsetX = offsetXDistribution(randomEngine);
+
+    const float detectorDiagonal(std::sqrt(4.f * m_minX * m_minX + m_settings.m_tpcWidthY * m_settings.m_tpcWidthY +
+        m_settings.m_tpcWidthZ * m_settings.m_tpcWidthZ));
+    this->Propagate(cosmicRay, detectorDiagonal, 0.002f, randomEngine);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerator::Propagate(
+    SyntheticParticle &particle, const float length, const float scatteringAngle, RandomEngine &randomEngine) const
+{
+    CartesianVector position(particle.m_vertex), direction(particle.m_direction);
+    float trajectoryLength(0.f);
+
+    while ((trajectoryLength < length) && this->IsInDetector(position))
+    {
+        particle.m_trajectory.push_back(position);
+        position = position + direction * m_settings.m_stepLength;
+        direction = SyntheticEventGenerator::Deflect(direction, scatteringAngle, randomEngine);
+        trajectoryLength += m_settings.m_stepLength;
+    }
+
+    // ATTN Particles leaving the detector are given the energy needed to travel the full length requested
+    particle.m_energy = SyntheticEventGenerator::GetMass(particle.m_particleId) + particle.m_dEdx * m_settings.m_mipEnergyLoss * length;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SyntheticEventGenerator::GenerateHits(const Pandora &pandora, RandomEngine &randomEngine)
+{
+    const HitType hitTypes[] = {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W};
+    std::normal_distribution<float> driftSmearingDistribution(0.f, 0.1f), fluctuationDistribution(1.f, 0.2f);
+
+    for (unsigned int particleIndex = 0; particleIndex < m_particleVector.size(); ++particleIndex)
+    {
+        const SyntheticParticle &particle(m_particleVector.at(particleIndex));
+
+        for (const CartesianVector &position : particle.m_trajectory)
+        {
+            unsigned int tpcIndex(0);
+
+            if (!this->GetTPCIndex(position.GetX(), tpcIndex))
+                continue;
+
+            // ATTN A drift offset moves hits in opposite directions in tpcs with opposite drift directions; hits leaving their tpc are lost
+            const float tpcMinX(m_minX + static_cast<float>(tpcIndex) * m_settings.m_tpcWidthX);
+            const float x(position.GetX() + ((1 == tpcIndex % 2) ? particle.m_offsetX : -particle.m_offsetX));
+
+            if ((x < tpcMinX) || (x > tpcMinX + m_settings.m_tpcWidthX))
+                continue;
+
+            for (const HitType hitType : hitTypes)
+            {
+                const CartesianVector projection(
+                    LArGeometryHelper::ProjectPosition(pandora, CartesianVector(x, position.GetY(), position.GetZ()), hitType));
+                const float wireCoordinate(m_settings.m_wirePitch * std::round(projection.GetZ() / m_settings.m_wirePitch));
+                const float mipEquivalentEnergy(std::max(0.1f, particle.m_dEdx * fluctuationDistribution(randomEngine)));
+                const CartesianVector hitPosition(x + driftSmearingDistribution(randomEngine), 0.f, wireCoordinate);
+
+                m_hitVector.emplace_back(hitPosition, hitType, tpcIndex, mipEquivalentEnergy, particleIndex);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SyntheticEventGenerator::GetTPCIndex(const float x, unsigned int &tpcIndex) const
+{
+    const float position((x - m_minX) / m_settings.m_tpcWidthX);
+
+    if ((position < 0.f) || (position >= static_cast<float>(m_settings.m_nTPCs)))
+        return false;
+
+    tpcIndex = static_cast<unsigned int>(position);
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SyntheticEventGenerator::IsInDetector(const CartesianVector &position) const
+{
+    return ((position.GetX() >= m_minX) && (position.GetX() <= -m_minX) && (std::fabs(position.GetY()) <= 0.5f * m_settings.m_tpcWidthY) &&
+        (position.GetZ() >= 0.f) && (position.GetZ() <= m_settings.m_tpcWidthZ));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector SyntheticEventGenerator::GetRandomDirection(RandomEngine &randomEngine)
+{
+    std::uniform_real_distribution<float> cosThetaDistribution(-1.f, 1.f), phiDistribution(0.f, 2.f * M_PI);
+    const float cosTheta(cosThetaDistribution(randomEngine)), sinTheta(std::sqrt(1.f - cosTheta * cosTheta));
+    const float phi(phiDistribution(randomEngine));
+
+    return CartesianVector(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector SyntheticEventGenerator::Deflect(const CartesianVector &direction, const float sigma, RandomEngine &randomEngine)
+{
+    if (sigma < std::numeric_limits<float>::epsilon())
+        return direction;
+
+    const CartesianVector reference((std::fabs(direction.GetX()) < 0.9f) ? CartesianVector(1.f, 0.f, 0.f) : CartesianVector(0.f, 1.f, 0.f));
+    const CartesianVector perpendicular1(direction.GetCrossProduct(reference).GetUnitVector());
+    const CartesianVector perpendicular2(direction.GetCrossProduct(perpendicular1));
+
+    std::normal_distribution<float> thetaDistribution(0.f, sigma);
+    std::uniform_real_distribution<float> phiDistribution(0.f, 2.f * M_PI);
+    const float theta(thetaDistribution(randomEngine)), phi(phiDistribution(randomEngine));
+
+    const CartesianVector transverse(perpendicular1 * std::cos(phi) + perpendicular2 * std::sin(phi));
+
+    return (direction * std::cos(theta) + transverse * std::sin(theta)).GetUnitVector();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float SyntheticEventGenerator::GetMass(const int particleId)
+{
+    switch (std::abs(particleId))
+    {
+        case 11:
+            return 0.000511f;
+        case 13:
+            return 0.105658f;
+        case 2212:
+            return 0.938272f;
+        default:
+            return 0.f;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SyntheticEventGenerator::SyntheticParticle::SyntheticParticle(
+    const int particleId, const MCProcess process, const int parentIndex, const CartesianVector &vertex, const CartesianVector &direction) :
+    m_particleId(particleId),
+    m_process(process),
+    m_nuanceCode(0),
+    m_parentIndex(parentIndex),
+    m_vertex(vertex),
+    m_direction(direction),
+    m_energy(0.f),
+    m_dEdx(1.f),
+    m_offsetX(0.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+SyntheticEventGenerator::SyntheticHit::SyntheticHit(const CartesianVector &position, const HitType hitType,
+    const unsigned int larTPCVolumeId, const float mipEquivalentEnergy, const unsigned int particleIndex) :
+    m_position(position),
+    m_hitType(hitType),
+    m_larTPCVolumeId(larTPCVolumeId),
+    m_mipEquivalentEnergy(mipEquivalentEnergy),
+    m_particleIndex(particleIndex)
+{
+}
+
+} // namespace lar_content
@@ -0,0 +1,276 @@
+/**
+ *  @file   benchmark/SyntheticEventGenerator.h
+ *
+ *  @brief  Header file for the synthetic event generator class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SYNTHETIC_EVENT_GENERATOR_H
+#define LAR_SYNTHETIC_EVENT_GENERATOR_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+#include "larpandoracontent/LArObjects/LArMCParticle.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+}
+
+namespace lar_content
+{
+
+/**
+ *  @brief  SyntheticEventGenerator class, creating a lar tpc geometry and seeded synthetic events containing an interaction with tracks and
+ *          showers, together with cosmic rays crossing the tpcs, as input hits and mc particles for a pandora instance
+ */
+class SyntheticEventGenerator
+{
+public:
+    /**
+     *  @brief  Settings class
+     */
+    class Settings
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Settings();
+
+        unsigned int m_seed;      ///< The seed, combined with the event number to seed the generation of each event
+        unsigned int m_nTPCs;     ///< The number of tpcs, placed side by side in x with alternating drift directions
+        float m_tpcWidthX;        ///< The width of each tpc in x, units cm
+        float m_tpcWidthY;        ///< The width of each tpc in y, units cm
+        float m_tpcWidthZ;        ///< The width of each tpc in z, units cm
+        float m_wirePitch;        ///< The wire pitch in each view, units cm
+        float m_wireAngleUV;      ///< The magnitude of the u and v wire angles, units radians
+        unsigned int m_nTracks;   ///< The number of tracks produced at the interaction vertex in each event
+        unsigned int m_nShowers;  ///< The number of showers produced at the interaction vertex in each event
+        unsigned int m_nCosmics;  ///< The number of cosmic rays in each event
+        float m_stepLength;       ///< The step length between consecutive trajectory points, units cm
+        float m_maxCosmicOffsetX; ///< The maximum drift offset applied to cosmic ray hits, modelling an unknown t0, units cm
+        float m_mipEnergyLoss;    ///< The energy loss per unit length of a minimum ionising particle, units GeV/cm
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  settings the generator settings
+     */
+    SyntheticEventGenerator(const Settings &settings);
+
+    /**
+     *  @brief  Create the lar tpcs in a pandora instance
+     *
+     *  @param  pandora the pandora instance
+     */
+    pandora::StatusCode CreateGeometry(const pandora::Pandora &pandora) const;
+
+    /**
+     *  @brief  Create the input hits and mc particles for an event in a pandora instance, which must already have been configured
+     *
+     *  @param  pandora the pandora instance
+     *  @param  eventNumber the event number, which identifies the event for a given seed
+     */
+    pandora::StatusCode CreateEvent(const pandora::Pandora &pandora, const unsigned int eventNumber);
+
+    /**
+     *  @brief  Get the number of hits created for the last event
+     *
+     *  @return the number of hits
+     */
+    unsigned int GetNHits() const;
+
+    /**
+     *  @brief  Write a seeded adaptive boosted decision tree, of the form read by AdaBoostDecisionTree, with complete trees of random cuts
+     *
+     *  @param  fileName the name of the output xml file
+     *  @param  bdtName the name of the bdt
+     *  @param  seed the seed for the random cuts
+     *  @param  nTrees the number of trees
+     *  @param  treeDepth the depth of each tree
+     *  @param  featureRanges the upper limit of the range of each feature, from which cut values are drawn
+     */
+    static pandora::StatusCode WriteBdtFile(const std::string &fileName, const std::string &bdtName, const unsigned int seed,
+        const unsigned int nTrees, const unsigned int treeDepth, const pandora::FloatVector &featureRanges);
+
+private:
+    typedef std::mt19937 RandomEngine;
+
+    /**
+     *  @brief  SyntheticParticle class
+     */
+    class SyntheticParticle
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  particleId the pdg code
+         *  @param  process the process creating the particle
+         *  @param  parentIndex the index of the parent particle, or -1 for a primary particle
+         *  @param  vertex the vertex position
+         *  @param  direction the initial direction
+         */
+        SyntheticParticle(const int particleId, const MCProcess process, const int parentIndex, const pandora::CartesianVector &vertex,
+            const pandora::CartesianVector &direction);
+
+        int m_particleId;                           ///< The pdg code
+        MCProcess m_process;                        ///< The process creating the particle
+        int m_nuanceCode;                           ///< The nuance code
+        int m_parentIndex;                          ///< The index of the parent particle, or -1 for a primary particle
+        pandora::CartesianVector m_vertex;          ///< The vertex position
+        pandora::CartesianVector m_direction;       ///< The initial direction
+        float m_energy;                             ///< The energy, units GeV
+        float m_dEdx;                               ///< The energy deposited per unit length, in units of the mip energy loss
+        float m_offsetX;                            ///< The drift offset applied to the particle hits, units cm
+        pandora::CartesianPointVector m_trajectory; ///< The trajectory points within the detector
+    };
+
+    typedef std::vector<SyntheticParticle> SyntheticParticleVector;
+
+    /**
+     *  @brief  SyntheticHit class
+     */
+    class SyntheticHit
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  position the projected hit position
+         *  @param  hitType the hit type
+         *  @param  larTPCVolumeId the lar tpc volume id
+         *  @param  mipEquivalentEnergy the deposited energy, in units of the mip energy loss over a single step
+         *  @param  particleIndex the index of the particle producing the hit
+         */
+        SyntheticHit(const pandora::CartesianVector &position, const pandora::HitType hitType, const unsigned int larTPCVolumeId,
+            const float mipEquivalentEnergy, const unsigned int particleIndex);
+
+        pandora::CartesianVector m_position; ///< The projected hit position
+        pandora::HitType m_hitType;          ///< The hit type
+        unsigned int m_larTPCVolumeId;       ///< The lar tpc volume id
+        float m_mipEquivalentEnergy;         ///< The deposited energy, in units of the mip energy loss over a single step
+        unsigned int m_particleIndex;        ///< The index of the particle producing the hit
+    };
+
+    typedef std::vector<SyntheticHit> SyntheticHitVector;
+
+    /**
+     *  @brief  Generate the neutrino-like interaction, with its track and shower daughters
+     *
+     *  @param  randomEngine the random engine
+     */
+    void GenerateInteraction(RandomEngine &randomEngine);
+
+    /**
+     *  @brief  Generate a shower, as an electron trunk with a set of daughter branches spreading about the shower axis
+     *
+     *  @param  parentIndex the index of the parent particle
+     *  @param  vertex the shower vertex
+     *  @param  direction the shower axis
+     *  @param  randomEngine the random engine
+     */
+    void GenerateShower(const int parentIndex, const pandora::CartesianVector &vertex, const pandora::CartesianVector &direction,
+        RandomEngine &randomEngine);
+
+    /**
+     *  @brief  Generate a cosmic ray muon, entering through the top of the detector
+     *
+     *  @param  randomEngine the random engine
+     */
+    void GenerateCosmicRay(RandomEngine &randomEngine);
+
+    /**
+     *  @brief  Step a particle through the detector, filling its trajectory, energy and endpoint
+     *
+     *  @param  particle the particle
+     *  @param  length the maximum trajectory length, units cm
+     *  @param  scatteringAngle the width of the change in direction at each step, units radians
+     *  @param  randomEngine the random engine
+     */
+    void Propagate(SyntheticParticle &particle, const float length, const float scatteringAngle, RandomEngine &randomEngine) const;
+
+    /**
+     *  @brief  Generate the hits in each view for each particle trajectory
+     *
+     *  @param  pandora the pandora instance
+     *  @param  randomEngine the random engine
+     */
+    void GenerateHits(const pandora::Pandora &pandora, RandomEngine &randomEngine);
+
+    /**
+     *  @brief  Get the index of the tpc containing a given x coordinate
+     *
+     *  @param  x the x coordinate
+     *  @param  tpcIndex to receive the tpc index
+     *
+     *  @return whether the x coordinate lies within a tpc
+     */
+    bool GetTPCIndex(const float x, unsigned int &tpcIndex) const;
+
+    /**
+     *  @brief  Whether a position lies within the detector
+     *
+     *  @param  position the position
+     *
+     *  @return boolean
+     */
+    bool IsInDetector(const pandora::CartesianVector &position) const;
+
+    /**
+     *  @brief  Get a random unit vector, isotropically distributed
+     *
+     *  @param  randomEngine the random engine
+     *
+     *  @return the unit vector
+     */
+    static pandora::CartesianVector GetRandomDirection(RandomEngine &randomEngine);
+
+    /**
+     *  @brief  Get a direction deflected from a given direction by a gaussian polar angle and uniform azimuthal angle
+     *
+     *  @param  direction the unit direction
+     *  @param  sigma the width of the polar angle distribution, units radians
+     *  @param  randomEngine the random engine
+     *
+     *  @return the deflected unit direction
+     */
+    static pandora::CartesianVector Deflect(const pandora::CartesianVector &direction, const float sigma, RandomEngine &randomEngine);
+
+    /**
+     *  @brief  Get the mass for a pdg code
+     *
+     *  @param  particleId the pdg code
+     *
+     *  @return the mass, units GeV
+     */
+    static float GetMass(const int particleId);
+
+    const Settings m_settings;                      ///< The generator settings
+    const float m_minX;                             ///< The minimum x coordinate of the detector, units cm
+    SyntheticParticleVector m_particleVector;       ///< The particles for the current event, addresses identifying the mc particles
+    SyntheticHitVector m_hitVector;                 ///< The hits for the current event, addresses identifying the calo hits
+    const LArCaloHitFactory m_caloHitFactory;       ///< The calo hit factory
+    const LArMCParticleFactory m_mcParticleFactory; ///< The mc particle factory
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int SyntheticEventGenerator::GetNHits() const
+{
+    return m_hitVector.size();
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SYNTHETIC_EVENT_GENERATOR_H
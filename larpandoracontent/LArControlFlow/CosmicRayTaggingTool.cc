@@ -15,6 +15,8 @@
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -105,7 +107,7 @@ void CosmicRayTaggingTool::FindAmbiguousPfos(const PfoList &parentCosmicRayPfos,
     m_face_Zu = parentMinZ;
     m_face_Zd = parentMaxZ;
 
-    PfoToPfoListMap pfoAssociationMap;
+    PfoToPfoVectorMap pfoAssociationMap;
     this->GetPfoAssociations(parentCosmicRayPfos, pfoAssociationMap);
 
     PfoToSliceIdMap pfoToSliceIdMap;
@@ -154,12 +156,13 @@ bool CosmicRayTaggingTool::GetValid3DCluster(const ParticleFlowObject *const pPf
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos, PfoToPfoListMap &pfoAssociationMap) const
+void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos, PfoToPfoVectorMap &pfoAssociationMap) const
 {
     // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
     const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
     const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
+    PfoVector fittedPfos;
     PfoToSlidingFitsMap pfoToSlidingFitsMap;
 
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
@@ -168,55 +171,101 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
         if (!this->GetValid3DCluster(pPfo, pCluster) || !pCluster)
             continue;
 
-        (void)pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo,
-            std::make_pair(ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))); // TODO Configurable
+        // ATTN The direction fit reuses the layer fit contributions of the position fit, so the cluster hits are only processed once
+        const ThreeDSlidingFitResult fitPos(pCluster, 5, layerPitch);
+        (void)pfoToSlidingFitsMap.insert(
+            PfoToSlidingFitsMap::value_type(pPfo, std::make_pair(fitPos, ThreeDSlidingFitResult(fitPos, 100)))); // TODO Configurable
+        fittedPfos.push_back(pPfo);
     }
 
-    for (const ParticleFlowObject *const pPfo1 : parentCosmicRayPfos)
-    {
-        PfoToSlidingFitsMap::const_iterator iter1(pfoToSlidingFitsMap.find(pPfo1));
-        if (pfoToSlidingFitsMap.end() == iter1)
-            continue;
+    if (fittedPfos.empty())
+        return;
 
-        const ThreeDSlidingFitResult &fitPos1(iter1->second.first), &fitDir1(iter1->second.second);
+    // Associated endpoints each lie within the maximum distance of the point of closest approach, allowing for uncertainties
+    const float sinDeltaTheta(std::sin(m_angularUncertainty * M_PI / 180.f));
+    const float maxDistToClosestApproach(m_maxAssociationDist + m_maxAssociationDist * sinDeltaTheta + m_positionalUncertainty);
+    const float searchDistance(1.01f * (2.f * maxDistToClosestApproach * (1.f + sinDeltaTheta) + m_positionalUncertainty));
+
+    EndpointKDNode3DList endpointKDNodes;
+    CartesianVector minPosition(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    CartesianVector maxPosition(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+
+    for (unsigned int iPfo = 0; iPfo < fittedPfos.size(); ++iPfo)
+    {
+        const ThreeDSlidingFitResult &fitPos(pfoToSlidingFitsMap.at(fittedPfos.at(iPfo)).first);
 
-        for (const ParticleFlowObject *const pPfo2 : parentCosmicRayPfos)
+        for (const CartesianVector &endpoint : {fitPos.GetGlobalMinLayerPosition(), fitPos.GetGlobalMaxLayerPosition()})
         {
-            if (pPfo1 == pPfo2)
-                continue;
+            endpointKDNodes.emplace_back(iPfo, endpoint.GetX(), endpoint.GetY(), endpoint.GetZ());
+            minPosition.SetValues(std::min(minPosition.GetX(), endpoint.GetX()), std::min(minPosition.GetY(), endpoint.GetY()),
+                std::min(minPosition.GetZ(), endpoint.GetZ()));
+            maxPosition.SetValues(std::max(maxPosition.GetX(), endpoint.GetX()), std::max(maxPosition.GetY(), endpoint.GetY()),
+                std::max(maxPosition.GetZ(), endpoint.GetZ()));
+        }
+    }
 
-            PfoToSlidingFitsMap::const_iterator iter2(pfoToSlidingFitsMap.find(pPfo2));
-            if (pfoToSlidingFitsMap.end() == iter2)
-                continue;
+    EndpointKDTree3D kdTree;
+    kdTree.build(endpointKDNodes, KDTreeCube(minPosition.GetX(), maxPosition.GetX(), minPosition.GetY(), maxPosition.GetY(),
+                                      minPosition.GetZ(), maxPosition.GetZ()));
+
+    for (unsigned int iPfo1 = 0; iPfo1 < fittedPfos.size(); ++iPfo1)
+    {
+        const ParticleFlowObject *const pPfo1(fittedPfos.at(iPfo1));
+        const ThreeDSlidingFitResult &fitPos1(pfoToSlidingFitsMap.at(pPfo1).first), &fitDir1(pfoToSlidingFitsMap.at(pPfo1).second);
+
+        std::vector<unsigned int> candidateIndices;
 
-            const ThreeDSlidingFitResult &fitPos2(iter2->second.first), &fitDir2(iter2->second.second);
-
-            // TODO Use existing LArPointingClusters and IsEmission/IsNode logic, for consistency
-            if (!(this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f,
-                      fitPos2.GetGlobalMinLayerPosition(), fitDir2.GetGlobalMinLayerDirection() * -1.f) ||
-                    this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f,
-                        fitPos2.GetGlobalMaxLayerPosition(), fitDir2.GetGlobalMaxLayerDirection()) ||
-                    this->CheckAssociation(fitPos1.GetGlobalMaxLayerPosition(), fitDir1.GetGlobalMaxLayerDirection(),
-                        fitPos2.GetGlobalMinLayerPosition(), fitDir2.GetGlobalMinLayerDirection() * -1.f) ||
-                    this->CheckAssociation(fitPos1.GetGlobalMaxLayerPosition(), fitDir1.GetGlobalMaxLayerDirection(),
-                        fitPos2.GetGlobalMaxLayerPosition(), fitDir2.GetGlobalMaxLayerDirection())))
+        for (const CartesianVector &endpoint : {fitPos1.GetGlobalMinLayerPosition(), fitPos1.GetGlobalMaxLayerPosition()})
+        {
+            EndpointKDNode3DList found;
+            kdTree.search(build_3d_kd_search_region(endpoint, searchDistance, searchDistance, searchDistance), found);
+
+            // ATTN Each unordered pair is considered once, from its lower index, testing both orderings as the checks are not symmetric
+            for (const EndpointKDNode3D &node : found)
             {
-                continue;
+                if (node.data > iPfo1)
+                    candidateIndices.push_back(node.data);
             }
+        }
 
-            PfoList &pfoList1(pfoAssociationMap[pPfo1]), &pfoList2(pfoAssociationMap[pPfo2]);
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+        candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
 
-            if (pfoList1.end() == std::find(pfoList1.begin(), pfoList1.end(), pPfo2))
-                pfoList1.push_back(pPfo2);
+        for (const unsigned int iPfo2 : candidateIndices)
+        {
+            const ParticleFlowObject *const pPfo2(fittedPfos.at(iPfo2));
+            const ThreeDSlidingFitResult &fitPos2(pfoToSlidingFitsMap.at(pPfo2).first), &fitDir2(pfoToSlidingFitsMap.at(pPfo2).second);
+
+            if (!this->CheckEndpointAssociations(fitPos1, fitDir1, fitPos2, fitDir2) &&
+                !this->CheckEndpointAssociations(fitPos2, fitDir2, fitPos1, fitDir1))
+            {
+                continue;
+            }
 
-            if (pfoList2.end() == std::find(pfoList2.begin(), pfoList2.end(), pPfo1))
-                pfoList2.push_back(pPfo1);
+            pfoAssociationMap[pPfo1].push_back(pPfo2);
+            pfoAssociationMap[pPfo2].push_back(pPfo1);
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool CosmicRayTaggingTool::CheckEndpointAssociations(const ThreeDSlidingFitResult &fitPos1, const ThreeDSlidingFitResult &fitDir1,
+    const ThreeDSlidingFitResult &fitPos2, const ThreeDSlidingFitResult &fitDir2) const
+{
+    // TODO Use existing LArPointingClusters and IsEmission/IsNode logic, for consistency
+    return (this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f,
+                fitPos2.GetGlobalMinLayerPosition(), fitDir2.GetGlobalMinLayerDirection() * -1.f) ||
+        this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f,
+            fitPos2.GetGlobalMaxLayerPosition(), fitDir2.GetGlobalMaxLayerDirection()) ||
+        this->CheckAssociation(fitPos1.GetGlobalMaxLayerPosition(), fitDir1.GetGlobalMaxLayerDirection(),
+            fitPos2.GetGlobalMinLayerPosition(), fitDir2.GetGlobalMinLayerDirection() * -1.f) ||
+        this->CheckAssociation(fitPos1.GetGlobalMaxLayerPosition(), fitDir1.GetGlobalMaxLayerDirection(),
+            fitPos2.GetGlobalMaxLayerPosition(), fitDir2.GetGlobalMaxLayerDirection()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool CosmicRayTaggingTool::CheckAssociation(
     const CartesianVector &endPoint1, const CartesianVector &endDir1, const CartesianVector &endPoint2, const CartesianVector &endDir2) const
 {
@@ -266,7 +315,7 @@ bool CosmicRayTaggingTool::CheckAssociation(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const PfoToPfoListMap &pfoAssociationMap, PfoToSliceIdMap &pfoToSliceIdMap) const
+void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const PfoToPfoVectorMap &pfoAssociationMap, PfoToSliceIdMap &pfoToSliceIdMap) const
 {
     SliceList sliceList;
 
@@ -305,14 +354,14 @@ void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, PfoList &slice) const
+void CosmicRayTaggingTool::FillSlice(const ParticleFlowObject *const pPfo, const PfoToPfoVectorMap &pfoAssociationMap, PfoList &slice) const
 {
     if (std::find(slice.begin(), slice.end(), pPfo) != slice.end())
         return;
 
     slice.push_back(pPfo);
 
-    PfoToPfoListMap::const_iterator iter(pfoAssociationMap.find(pPfo));
+    PfoToPfoVectorMap::const_iterator iter(pfoAssociationMap.find(pPfo));
 
     if (pfoAssociationMap.end() != iter)
     {
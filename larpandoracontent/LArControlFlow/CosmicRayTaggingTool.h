@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -77,7 +79,7 @@ private:
      */
     bool GetValid3DCluster(const pandora::ParticleFlowObject *const pPfo, const pandora::Cluster *&pCluster3D) const;
 
-    typedef std::unordered_map<const pandora::ParticleFlowObject *, pandora::PfoList> PfoToPfoListMap;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, pandora::PfoVector> PfoToPfoVectorMap;
 
     /**
      *  @brief  Get mapping between Pfos that are associated with it other by pointing
@@ -85,7 +87,20 @@ private:
      *  @param  parentCosmicRayPfos input list of Pfos
      *  @param  pfoAssociationsMap to receive the output mapping between associated Pfos
      */
-    void GetPfoAssociations(const pandora::PfoList &parentCosmicRayPfos, PfoToPfoListMap &pfoAssociationMap) const;
+    void GetPfoAssociations(const pandora::PfoList &parentCosmicRayPfos, PfoToPfoVectorMap &pfoAssociationMap) const;
+
+    /**
+     *  @brief  Check whether any pair of endpoints of two Pfos are associated by distance of closest approach
+     *
+     *  @param  fitPos1 the sliding fit result used for the endpoint positions of Pfo 1
+     *  @param  fitDir1 the sliding fit result used for the endpoint directions of Pfo 1
+     *  @param  fitPos2 the sliding fit result used for the endpoint positions of Pfo 2
+     *  @param  fitDir2 the sliding fit result used for the endpoint directions of Pfo 2
+     *
+     *  @return whether the Pfos are associated
+     */
+    bool CheckEndpointAssociations(const ThreeDSlidingFitResult &fitPos1, const ThreeDSlidingFitResult &fitDir1,
+        const ThreeDSlidingFitResult &fitPos2, const ThreeDSlidingFitResult &fitDir2) const;
 
     /**
      *  @brief  Check whethe two Pfo endpoints are associated by distance of closest approach
@@ -109,7 +124,7 @@ private:
      *  @param  pfoAssociationMap mapping between Pfos and other associated Pfos
      *  @param  pfoToSliceIdMap to receive the mapping between Pfos and their slice ID
      */
-    void SliceEvent(const pandora::PfoList &parentCosmicRayPfos, const PfoToPfoListMap &pfoAssociationMap, PfoToSliceIdMap &pfoToSliceIdMap) const;
+    void SliceEvent(const pandora::PfoList &parentCosmicRayPfos, const PfoToPfoVectorMap &pfoAssociationMap, PfoToSliceIdMap &pfoToSliceIdMap) const;
 
     /**
      *  @brief  Fill a slice iteratively using Pfo associations
@@ -118,7 +133,7 @@ private:
      *  @param  pfoAssociationMap mapping between Pfos and other associated Pfos
      *  @param  slice the slice to add Pfos to
      */
-    void FillSlice(const pandora::ParticleFlowObject *const pPfo, const PfoToPfoListMap &pfoAssociationMap, pandora::PfoList &slice) const;
+    void FillSlice(const pandora::ParticleFlowObject *const pPfo, const PfoToPfoVectorMap &pfoAssociationMap, pandora::PfoList &slice) const;
 
     /**
      *  @brief  Make a list of CRCandidates
@@ -187,6 +202,10 @@ private:
     typedef std::unordered_map<const pandora::ParticleFlowObject *, SlidingFitPair> PfoToSlidingFitsMap;
     typedef std::vector<pandora::PfoList> SliceList;
 
+    typedef KDTreeLinkerAlgo<unsigned int, 3> EndpointKDTree3D;
+    typedef KDTreeNodeInfoT<unsigned int, 3> EndpointKDNode3D;
+    typedef std::vector<EndpointKDNode3D> EndpointKDNode3DList;
+
     /**
      *  @brief  Choose a set of cuts using a keyword - "cautious" = remove as few neutrinos as possible
      *          "nominal" = optimised to maximise CR removal whilst preserving neutrinos
@@ -0,0 +1,119 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/EventSequencer.cc
+ *
+ *  @brief  Implementation of the event sequencer class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArControlFlow/EventSequencer.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+std::mutex EventSequencer::m_registryMutex;
+EventSequencer::CurrentEventMap EventSequencer::m_currentEventMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventSequencer::EventSequencer(const unsigned int nSlots) :
+    m_nSlots(nSlots),
+    m_turn(0),
+    m_finishedSlots(nSlots, false),
+    m_nFinishedSlots(0)
+{
+    if (0 == m_nSlots)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSequencer::WaitForTurn(const unsigned int sequenceNumber)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this, sequenceNumber] { return m_turn == sequenceNumber; });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSequencer::Complete(const unsigned int sequenceNumber)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this, sequenceNumber] { return m_turn == sequenceNumber; });
+        this->AdvanceTurn();
+    }
+
+    m_condition.notify_all();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSequencer::Finish(const unsigned int sequenceNumber)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this, sequenceNumber] { return m_turn == sequenceNumber; });
+
+        if (!m_finishedSlots.at(sequenceNumber % m_nSlots))
+        {
+            m_finishedSlots.at(sequenceNumber % m_nSlots) = true;
+            ++m_nFinishedSlots;
+        }
+
+        this->AdvanceTurn();
+    }
+
+    m_condition.notify_all();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSequencer::SetCurrentEvent(
+    const Pandora *const pPandora, EventSequencer *const pEventSequencer, const unsigned int sequenceNumber)
+{
+    const std::lock_guard<std::mutex> lock(m_registryMutex);
+    m_currentEventMap[pPandora] = CurrentEvent{pEventSequencer, sequenceNumber};
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSequencer::RemoveCurrentEvent(const Pandora *const pPandora)
+{
+    const std::lock_guard<std::mutex> lock(m_registryMutex);
+    m_currentEventMap.erase(pPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSequencer::WaitForCurrentEvent(const Pandora *const pPandora)
+{
+    CurrentEvent currentEvent{nullptr, 0};
+    {
+        const std::lock_guard<std::mutex> lock(m_registryMutex);
+        CurrentEventMap::const_iterator iter(m_currentEventMap.find(pPandora));
+
+        if (m_currentEventMap.end() == iter)
+            return;
+
+        currentEvent = iter->second;
+    }
+
+    currentEvent.m_pEventSequencer->WaitForTurn(currentEvent.m_sequenceNumber);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventSequencer::AdvanceTurn()
+{
+    ++m_turn;
+
+    while ((m_nFinishedSlots < m_nSlots) && m_finishedSlots.at(m_turn % m_nSlots))
+        ++m_turn;
+}
+
+} // namespace lar_content
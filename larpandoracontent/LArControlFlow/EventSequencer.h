@@ -0,0 +1,119 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/EventSequencer.h
+ *
+ *  @brief  Header file for the event sequencer class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_SEQUENCER_H
+#define LAR_EVENT_SEQUENCER_H 1
+
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventSequencer class, used to order the output of events processed concurrently by a fixed number of slots, each a Pandora
+ *          instance processing one event at a time. Sequence numbers are dealt to the slots in turn, so that, for n slots, slot i processes
+ *          events i, i + n, i + 2n, etc. Each event takes its turn once all events with lower sequence numbers are complete.
+ */
+class EventSequencer
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  nSlots the number of slots
+     */
+    EventSequencer(const unsigned int nSlots);
+
+    /**
+     *  @brief  Wait until all events with lower sequence numbers are complete
+     *
+     *  @param  sequenceNumber the sequence number of the event
+     */
+    void WaitForTurn(const unsigned int sequenceNumber);
+
+    /**
+     *  @brief  Mark an event as complete, first waiting for its turn
+     *
+     *  @param  sequenceNumber the sequence number of the event
+     */
+    void Complete(const unsigned int sequenceNumber);
+
+    /**
+     *  @brief  Mark a slot as finished, first waiting for the turn of its next sequence number. The sequence numbers dealt to a finished
+     *          slot are skipped.
+     *
+     *  @param  sequenceNumber the next sequence number of the slot, for which there is no event
+     */
+    void Finish(const unsigned int sequenceNumber);
+
+    /**
+     *  @brief  Set the event currently being processed by a pandora instance
+     *
+     *  @param  pPandora address of the pandora instance
+     *  @param  pEventSequencer address of the event sequencer responsible for the pandora instance
+     *  @param  sequenceNumber the sequence number of the event
+     */
+    static void SetCurrentEvent(
+        const pandora::Pandora *const pPandora, EventSequencer *const pEventSequencer, const unsigned int sequenceNumber);
+
+    /**
+     *  @brief  Remove the record of the event currently being processed by a pandora instance
+     *
+     *  @param  pPandora address of the pandora instance
+     */
+    static void RemoveCurrentEvent(const pandora::Pandora *const pPandora);
+
+    /**
+     *  @brief  Wait for the turn of the event currently being processed by a pandora instance. Returns immediately if the pandora
+     *          instance has no current event, i.e. its events are not being sequenced.
+     *
+     *  @param  pPandora address of the pandora instance
+     */
+    static void WaitForCurrentEvent(const pandora::Pandora *const pPandora);
+
+private:
+    /**
+     *  @brief  Move the turn on to the next event, skipping sequence numbers dealt to finished slots. Requires the mutex to be held.
+     */
+    void AdvanceTurn();
+
+    /**
+     *  @brief  CurrentEvent class, identifying the event currently being processed by a pandora instance
+     */
+    class CurrentEvent
+    {
+    public:
+        EventSequencer *m_pEventSequencer; ///< Address of the event sequencer responsible for the pandora instance
+        unsigned int m_sequenceNumber;     ///< The sequence number of the event
+    };
+
+    typedef std::unordered_map<const pandora::Pandora *, CurrentEvent> CurrentEventMap;
+
+    const unsigned int m_nSlots;         ///< The number of slots
+    std::mutex m_mutex;                  ///< The mutex protecting the turn and the finished slots
+    std::condition_variable m_condition; ///< The condition variable signalling a change of turn
+    unsigned int m_turn;                 ///< The sequence number of the event whose turn it is
+    std::vector<bool> m_finishedSlots;   ///< Whether each slot is finished
+    unsigned int m_nFinishedSlots;       ///< The number of finished slots
+
+    static std::mutex m_registryMutex;        ///< The mutex protecting the current event map
+    static CurrentEventMap m_currentEventMap; ///< The map from pandora instance to the event it is currently processing
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_SEQUENCER_H
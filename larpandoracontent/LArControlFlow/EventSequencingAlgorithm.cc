@@ -0,0 +1,39 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/EventSequencingAlgorithm.cc
+ *
+ *  @brief  Implementation of the event sequencing algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArControlFlow/EventSequencer.h"
+#include "larpandoracontent/LArControlFlow/EventSequencingAlgorithm.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+EventSequencingAlgorithm::EventSequencingAlgorithm()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventSequencingAlgorithm::Run()
+{
+    EventSequencer::WaitForCurrentEvent(&this->GetPandora());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventSequencingAlgorithm::ReadSettings(const TiXmlHandle /*xmlHandle*/)
+{
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,35 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/EventSequencingAlgorithm.h
+ *
+ *  @brief  Header file for the event sequencing algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_SEQUENCING_ALGORITHM_H
+#define LAR_EVENT_SEQUENCING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventSequencingAlgorithm class, waiting until all earlier events processed by a parallel event driver are complete, so that
+ *          the algorithms that follow write their output in a deterministic order. Does nothing if the events are not being sequenced.
+ */
+class EventSequencingAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    EventSequencingAlgorithm();
+
+private:
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_SEQUENCING_ALGORITHM_H
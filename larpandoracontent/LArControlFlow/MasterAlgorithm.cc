@@ -15,6 +15,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
@@ -152,6 +153,9 @@ void MasterAlgorithm::StitchPfos(
 
 StatusCode MasterAlgorithm::Run()
 {
+    if (m_pAlgorithmProfiler)
+        m_pAlgorithmProfiler->BeginEvent();
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Reset());
 
     if (!m_workerInstancesInitialized)
@@ -192,6 +196,9 @@ StatusCode MasterAlgorithm::Run()
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SelectBestSliceHypotheses(nuSliceHypotheses, crSliceHypotheses));
     }
 
+    if (m_pAlgorithmProfiler)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pAlgorithmProfiler->WriteEvent());
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -313,6 +320,8 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (m_printOverallRecoStatus)
             std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
 
+        const AlgorithmProfiler::ScopedMeasurement measurement(
+            m_pAlgorithmProfiler.get(), "CRWorkerInstance_" + std::to_string(larTPC.GetLArTPCVolumeId()));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
     }
 
@@ -354,7 +363,10 @@ StatusCode MasterAlgorithm::StitchCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap,
     }
 
     for (StitchingBaseTool *const pStitchingTool : m_stitchingToolVector)
+    {
+        const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), pStitchingTool->GetInstanceName());
         pStitchingTool->Run(this, pRecreatedCRPfos, pfoToLArTPCMap, stitchedPfosToX0Map);
+    }
 
     if (m_visualizeOverallRecoStatus)
     {
@@ -385,7 +397,10 @@ StatusCode MasterAlgorithm::TagCosmicRayPfos(const PfoToFloatMap &stitchedPfosTo
     }
 
     for (CosmicRayTaggingBaseTool *const pCosmicRayTaggingTool : m_cosmicRayTaggingToolVector)
+    {
+        const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), pCosmicRayTaggingTool->GetInstanceName());
         pCosmicRayTaggingTool->FindAmbiguousPfos(nonStitchedParentCosmicRayPfos, ambiguousPfos, this);
+    }
 
     for (const Pfo *const pPfo : nonStitchedParentCosmicRayPfos)
     {
@@ -486,7 +501,10 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
             std::cout << "Running slicing worker instance" << std::endl;
 
         const PfoList *pSlicePfos(nullptr);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSlicingWorkerInstance));
+        {
+            const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), "SlicingWorkerInstance");
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSlicingWorkerInstance));
+        }
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSlicingWorkerInstance, pSlicePfos));
 
         if (m_visualizeOverallRecoStatus)
@@ -520,6 +538,7 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
         SliceVector inputSliceVector(sliceVector);
         for (SliceSelectionBaseTool *const pSliceSelectionTool : m_sliceSelectionToolVector)
         {
+            const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), pSliceSelectionTool->GetInstanceName());
             pSliceSelectionTool->SelectSlices(this, inputSliceVector, selectedSliceVector);
             inputSliceVector = selectedSliceVector;
         }
@@ -551,7 +570,10 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
                 std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
 
             const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
+            {
+                const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), "SliceNuWorkerInstance");
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
+            }
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
             nuSliceHypotheses.push_back(*pSliceNuPfos);
 
@@ -569,7 +591,10 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
                 std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
 
             const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
+            {
+                const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), "SliceCRWorkerInstance");
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
+            }
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
             crSliceHypotheses.push_back(*pSliceCRPfos);
 
@@ -607,7 +632,10 @@ StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuS
     if (m_shouldPerformSliceId)
     {
         for (SliceIdBaseTool *const pSliceIdTool : m_sliceIdToolVector)
+        {
+            const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), pSliceIdTool->GetInstanceName());
             pSliceIdTool->SelectOutputPfos(this, nuSliceHypotheses, crSliceHypotheses, selectedSlicePfos);
+        }
     }
     else if (m_shouldRunNeutrinoRecoOption != m_shouldRunCosmicRecoOption)
     {
@@ -918,23 +946,7 @@ const Pandora *MasterAlgorithm::CreateWorkerInstance(
     MultiPandoraApi::AddDaughterPandoraInstance(&(this->GetPandora()), pPandora);
 
     // The LArTPC
-    PandoraApi::Geometry::LArTPC::Parameters larTPCParameters;
-    larTPCParameters.m_larTPCVolumeId = larTPC.GetLArTPCVolumeId();
-    larTPCParameters.m_centerX = larTPC.GetCenterX();
-    larTPCParameters.m_centerY = larTPC.GetCenterY();
-    larTPCParameters.m_centerZ = larTPC.GetCenterZ();
-    larTPCParameters.m_widthX = larTPC.GetWidthX();
-    larTPCParameters.m_widthY = larTPC.GetWidthY();
-    larTPCParameters.m_widthZ = larTPC.GetWidthZ();
-    larTPCParameters.m_wirePitchU = larTPC.GetWirePitchU();
-    larTPCParameters.m_wirePitchV = larTPC.GetWirePitchV();
-    larTPCParameters.m_wirePitchW = larTPC.GetWirePitchW();
-    larTPCParameters.m_wireAngleU = larTPC.GetWireAngleU();
-    larTPCParameters.m_wireAngleV = larTPC.GetWireAngleV();
-    larTPCParameters.m_wireAngleW = larTPC.GetWireAngleW();
-    larTPCParameters.m_sigmaUVW = larTPC.GetSigmaUVW();
-    larTPCParameters.m_isDriftInPositiveX = larTPC.IsDriftInPositiveX();
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LArTPC::Create(*pPandora, larTPCParameters));
+    LArGeometryHelper::CopyLArTPC(*pPandora, larTPC);
 
     const float tpcMinX(larTPC.GetCenterX() - 0.5f * larTPC.GetWidthX()), tpcMaxX(larTPC.GetCenterX() + 0.5f * larTPC.GetWidthX());
 
@@ -946,22 +958,10 @@ const Pandora *MasterAlgorithm::CreateWorkerInstance(
         if (pLineGap && (((pLineGap->GetLineEndX() >= tpcMinX) && (pLineGap->GetLineEndX() <= tpcMaxX)) ||
                             ((pLineGap->GetLineStartX() >= tpcMinX) && (pLineGap->GetLineStartX() <= tpcMaxX))))
         {
-            PandoraApi::Geometry::LineGap::Parameters lineGapParameters;
             const LineGapType lineGapType(pLineGap->GetLineGapType());
-            lineGapParameters.m_lineGapType = lineGapType;
-            lineGapParameters.m_lineStartX = pLineGap->GetLineStartX();
-            lineGapParameters.m_lineEndX = pLineGap->GetLineEndX();
-
-            if (m_fullWidthCRWorkerWireGaps &&
-                ((lineGapType == TPC_WIRE_GAP_VIEW_U) || (lineGapType == TPC_WIRE_GAP_VIEW_V) || (lineGapType == TPC_WIRE_GAP_VIEW_W)))
-            {
-                lineGapParameters.m_lineStartX = -std::numeric_limits<float>::max();
-                lineGapParameters.m_lineEndX = std::numeric_limits<float>::max();
-            }
-
-            lineGapParameters.m_lineStartZ = pLineGap->GetLineStartZ();
-            lineGapParameters.m_lineEndZ = pLineGap->GetLineEndZ();
-            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LineGap::Create(*pPandora, lineGapParameters));
+            const bool isWireGap(
+                (lineGapType == TPC_WIRE_GAP_VIEW_U) || (lineGapType == TPC_WIRE_GAP_VIEW_V) || (lineGapType == TPC_WIRE_GAP_VIEW_W));
+            LArGeometryHelper::CopyLineGap(*pPandora, *pLineGap, m_fullWidthCRWorkerWireGaps && isWireGap);
         }
     }
 
@@ -1035,15 +1035,7 @@ const Pandora *MasterAlgorithm::CreateWorkerInstance(
         const LineGap *const pLineGap(dynamic_cast<const LineGap *>(pGap));
 
         if (pLineGap)
-        {
-            PandoraApi::Geometry::LineGap::Parameters lineGapParameters;
-            lineGapParameters.m_lineGapType = pLineGap->GetLineGapType();
-            lineGapParameters.m_lineStartX = pLineGap->GetLineStartX();
-            lineGapParameters.m_lineEndX = pLineGap->GetLineEndX();
-            lineGapParameters.m_lineStartZ = pLineGap->GetLineStartZ();
-            lineGapParameters.m_lineEndZ = pLineGap->GetLineEndZ();
-            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LineGap::Create(*pPandora, lineGapParameters));
-        }
+            LArGeometryHelper::CopyLineGap(*pPandora, *pLineGap);
     }
 
     // Configuration
@@ -1215,6 +1207,12 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "RecreatedVertexListName", m_recreatedVertexListName));
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InTimeMaxX0", m_inTimeMaxX0));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ProfilingOutputFileName", m_profilingOutputFileName));
+
+    if (!m_profilingOutputFileName.empty())
+        m_pAlgorithmProfiler = std::make_unique<AlgorithmProfiler>(this->GetInstanceName(), m_profilingOutputFileName);
+
     return STATUS_CODE_SUCCESS;
 }
 
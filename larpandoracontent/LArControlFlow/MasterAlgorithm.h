@@ -14,6 +14,9 @@
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include "larpandoracontent/LArUtility/AlgorithmProfiler.h"
+
+#include <memory>
 #include <unordered_map>
 
 namespace lar_content
@@ -353,6 +356,9 @@ protected:
 
     float m_inTimeMaxX0;                   ///< Cut on X0 to determine whether particle is clear cosmic ray
     LArCaloHitFactory m_larCaloHitFactory; ///< Factory for creating LArCaloHits during hit copying
+
+    std::string m_profilingOutputFileName;                   ///< The output file for worker instance and tool profiling, empty to disable
+    std::unique_ptr<AlgorithmProfiler> m_pAlgorithmProfiler; ///< The algorithm profiler, if profiling is enabled
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -16,13 +16,20 @@ MultiPandoraApiImpl MultiPandoraApi::m_multiPandoraApiImpl;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const PandoraInstanceMap &MultiPandoraApi::GetPandoraInstanceMap()
+PandoraInstanceMap MultiPandoraApi::GetPandoraInstanceMap()
 {
     return m_multiPandoraApiImpl.GetPandoraInstanceMap();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool MultiPandoraApi::IsPrimaryPandoraInstance(const pandora::Pandora *const pPandora)
+{
+    return m_multiPandoraApiImpl.IsPrimaryPandoraInstance(pPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const pandora::Pandora *MultiPandoraApi::GetPandoraInstance(const pandora::Pandora *const pPrimaryPandora, const unsigned int volumeId)
 {
     return m_multiPandoraApiImpl.GetPandoraInstance(pPrimaryPandora, volumeId);
@@ -30,7 +37,7 @@ const pandora::Pandora *MultiPandoraApi::GetPandoraInstance(const pandora::Pando
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const PandoraInstanceList &MultiPandoraApi::GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora)
+PandoraInstanceList MultiPandoraApi::GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora)
 {
     return m_multiPandoraApiImpl.GetDaughterPandoraInstanceList(pPrimaryPandora);
 }
@@ -25,7 +25,8 @@ typedef std::unordered_map<const pandora::Pandora *, PandoraInstanceList> Pandor
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
- *  @brief  MultiPandoraApi class
+ *  @brief  MultiPandoraApi class. All functions may be called concurrently, e.g. by primary pandora instances processing events on
+ *          separate threads; lookups take no global lock unless instances have been added or deleted since the calling thread last looked.
  */
 class MultiPandoraApi
 {
@@ -33,9 +34,18 @@ public:
     /**
      *  @brief  Get the pandora instance map
      *
-     *  @return the pandora instance map
+     *  @return a copy of the pandora instance map
      */
-    static const PandoraInstanceMap &GetPandoraInstanceMap();
+    static PandoraInstanceMap GetPandoraInstanceMap();
+
+    /**
+     *  @brief  Whether a pandora instance is a primary pandora instance
+     *
+     *  @param  pPandora the address of the pandora instance
+     *
+     *  @return boolean
+     */
+    static bool IsPrimaryPandoraInstance(const pandora::Pandora *const pPandora);
 
     /**
      *  @brief  Get the address of the pandora instance associated with a given primary pandora instance and volume id number
@@ -52,9 +62,9 @@ public:
      *
      *  @param  pPrimaryPandora the address of the primary pandora instance
      *
-     *  @return the daughter pandora instance list
+     *  @return a copy of the daughter pandora instance list
      */
-    static const PandoraInstanceList &GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora);
+    static PandoraInstanceList GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora);
 
     /**
      *  @brief  Get the address of the primary pandora instance associated with a given daughter pandora instance
@@ -11,28 +11,37 @@
 
 #include "larpandoracontent/LArControlFlow/MultiPandoraApiImpl.h"
 
-const PandoraInstanceMap &MultiPandoraApiImpl::GetPandoraInstanceMap() const
+PandoraInstanceMap MultiPandoraApiImpl::GetPandoraInstanceMap() const
 {
-    return m_primaryToDaughtersMap;
+    return this->GetRegistry().m_primaryToDaughtersMap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MultiPandoraApiImpl::IsPrimaryPandoraInstance(const pandora::Pandora *const pPandora) const
+{
+    return (this->GetRegistry().m_primaryToDaughtersMap.count(pPandora) > 0);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 const pandora::Pandora *MultiPandoraApiImpl::GetPandoraInstance(const pandora::Pandora *const pPrimaryPandora, const unsigned int volumeId) const
 {
-    PandoraInstanceList instanceList(this->GetDaughterPandoraInstanceList(pPrimaryPandora));
+    const Registry &registry(this->GetRegistry());
+    PandoraInstanceMap::const_iterator iter = registry.m_primaryToDaughtersMap.find(pPrimaryPandora);
+
+    if (registry.m_primaryToDaughtersMap.end() == iter)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    PandoraInstanceList instanceList(iter->second);
     instanceList.push_back(pPrimaryPandora);
 
     for (const pandora::Pandora *const pPandora : instanceList)
     {
-        try
-        {
-            if (volumeId == this->GetVolumeId(pPandora))
-                return pPandora;
-        }
-        catch (const pandora::StatusCodeException &)
-        {
-        }
+        unsigned int instanceVolumeId(0);
+
+        if (MultiPandoraApiImpl::GetVolumeId(registry, pPandora, instanceVolumeId) && (volumeId == instanceVolumeId))
+            return pPandora;
     }
 
     throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
@@ -40,11 +49,12 @@ const pandora::Pandora *MultiPandoraApiImpl::GetPandoraInstance(const pandora::P
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const PandoraInstanceList &MultiPandoraApiImpl::GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const
+PandoraInstanceList MultiPandoraApiImpl::GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const
 {
-    PandoraInstanceMap::const_iterator iter = m_primaryToDaughtersMap.find(pPrimaryPandora);
+    const Registry &registry(this->GetRegistry());
+    PandoraInstanceMap::const_iterator iter = registry.m_primaryToDaughtersMap.find(pPrimaryPandora);
 
-    if (m_primaryToDaughtersMap.end() == iter)
+    if (registry.m_primaryToDaughtersMap.end() == iter)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
     return iter->second;
@@ -54,9 +64,10 @@ const PandoraInstanceList &MultiPandoraApiImpl::GetDaughterPandoraInstanceList(c
 
 const pandora::Pandora *MultiPandoraApiImpl::GetPrimaryPandoraInstance(const pandora::Pandora *const pDaughterPandora) const
 {
-    PandoraRelationMap::const_iterator iter = m_daughterToPrimaryMap.find(pDaughterPandora);
+    const Registry &registry(this->GetRegistry());
+    PandoraRelationMap::const_iterator iter = registry.m_daughterToPrimaryMap.find(pDaughterPandora);
 
-    if (m_daughterToPrimaryMap.end() == iter)
+    if (registry.m_daughterToPrimaryMap.end() == iter)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
     return iter->second;
@@ -66,28 +77,35 @@ const pandora::Pandora *MultiPandoraApiImpl::GetPrimaryPandoraInstance(const pan
 
 unsigned int MultiPandoraApiImpl::GetVolumeId(const pandora::Pandora *const pPandora) const
 {
-    PandoraToVolumeIdMap::const_iterator iter = m_pandoraToVolumeIdMap.find(pPandora);
+    unsigned int volumeId(0);
 
-    if (m_pandoraToVolumeIdMap.end() == iter)
+    if (!MultiPandoraApiImpl::GetVolumeId(this->GetRegistry(), pPandora, volumeId))
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return volumeId;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void MultiPandoraApiImpl::SetVolumeId(const pandora::Pandora *const pPandora, const unsigned int volumeId)
 {
-    if (m_pandoraToVolumeIdMap.count(pPandora))
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_ptr<Registry> pRegistry(this->CopyRegistry());
+
+    if (pRegistry->m_pandoraToVolumeIdMap.count(pPandora))
         throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
 
-    if (!m_pandoraToVolumeIdMap.insert(PandoraToVolumeIdMap::value_type(pPandora, volumeId)).second)
+    if (!pRegistry->m_pandoraToVolumeIdMap.insert(PandoraToVolumeIdMap::value_type(pPandora, volumeId)).second)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+
+    this->ReplaceRegistry(pRegistry);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-MultiPandoraApiImpl::MultiPandoraApiImpl()
+MultiPandoraApiImpl::MultiPandoraApiImpl() :
+    m_pRegistry(std::make_shared<const Registry>()),
+    m_version(0)
 {
 }
 
@@ -96,7 +114,7 @@ MultiPandoraApiImpl::MultiPandoraApiImpl()
 MultiPandoraApiImpl::~MultiPandoraApiImpl()
 {
     // ATTN This is a copy of the input map, which will be modified by calls to delete pandora instances
-    PandoraInstanceMap pandoraInstanceMap(m_primaryToDaughtersMap);
+    const PandoraInstanceMap pandoraInstanceMap(m_pRegistry->m_primaryToDaughtersMap);
 
     for (const auto &mapElement : pandoraInstanceMap)
         this->DeletePandoraInstances(mapElement.first);
@@ -106,23 +124,32 @@ MultiPandoraApiImpl::~MultiPandoraApiImpl()
 
 void MultiPandoraApiImpl::AddPrimaryPandoraInstance(const pandora::Pandora *const pPrimaryPandora)
 {
-    if (!m_primaryToDaughtersMap.insert(PandoraInstanceMap::value_type(pPrimaryPandora, PandoraInstanceList())).second)
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_ptr<Registry> pRegistry(this->CopyRegistry());
+
+    if (!pRegistry->m_primaryToDaughtersMap.insert(PandoraInstanceMap::value_type(pPrimaryPandora, PandoraInstanceList())).second)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
+
+    this->ReplaceRegistry(pRegistry);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void MultiPandoraApiImpl::AddDaughterPandoraInstance(const pandora::Pandora *const pPrimaryPandora, const pandora::Pandora *const pDaughterPandora)
 {
-    PandoraInstanceMap::iterator iter = m_primaryToDaughtersMap.find(pPrimaryPandora);
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_ptr<Registry> pRegistry(this->CopyRegistry());
+    PandoraInstanceMap::iterator iter = pRegistry->m_primaryToDaughtersMap.find(pPrimaryPandora);
 
-    if (m_primaryToDaughtersMap.end() == iter)
+    if (pRegistry->m_primaryToDaughtersMap.end() == iter)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
     iter->second.push_back(pDaughterPandora);
 
-    if (!m_daughterToPrimaryMap.insert(PandoraRelationMap::value_type(pDaughterPandora, pPrimaryPandora)).second)
+    if (!pRegistry->m_daughterToPrimaryMap.insert(PandoraRelationMap::value_type(pDaughterPandora, pPrimaryPandora)).second)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+
+    this->ReplaceRegistry(pRegistry);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -131,23 +158,82 @@ void MultiPandoraApiImpl::DeletePandoraInstances(const pandora::Pandora *const p
 {
     PandoraInstanceList pandoraInstanceList;
 
-    try
     {
-        pandoraInstanceList = this->GetDaughterPandoraInstanceList(pPrimaryPandora);
-    }
-    catch (const pandora::StatusCodeException &)
-    {
-        std::cout << "MultiPandoraApiImpl::DeletePandoraInstances - unable to find daughter instances associated with primary "
-                  << pPrimaryPandora << std::endl;
-    }
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        std::shared_ptr<Registry> pRegistry(this->CopyRegistry());
+        PandoraInstanceMap::const_iterator iter = pRegistry->m_primaryToDaughtersMap.find(pPrimaryPandora);
+
+        if (pRegistry->m_primaryToDaughtersMap.end() != iter)
+        {
+            pandoraInstanceList = iter->second;
+        }
+        else
+        {
+            std::cout << "MultiPandoraApiImpl::DeletePandoraInstances - unable to find daughter instances associated with primary "
+                      << pPrimaryPandora << std::endl;
+        }
+
+        pandoraInstanceList.push_back(pPrimaryPandora);
+        pRegistry->m_primaryToDaughtersMap.erase(pPrimaryPandora);
+
+        for (const pandora::Pandora *const pPandora : pandoraInstanceList)
+        {
+            pRegistry->m_pandoraToVolumeIdMap.erase(pPandora);
+            pRegistry->m_daughterToPrimaryMap.erase(pPandora);
+        }
 
-    pandoraInstanceList.push_back(pPrimaryPandora);
-    m_primaryToDaughtersMap.erase(pPrimaryPandora);
+        this->ReplaceRegistry(pRegistry);
+    }
 
+    // ATTN Instances are deleted without holding the lock, as their algorithms may themselves use the multi pandora api when destroyed
     for (const pandora::Pandora *const pPandora : pandoraInstanceList)
-    {
-        m_pandoraToVolumeIdMap.erase(pPandora);
-        m_daughterToPrimaryMap.erase(pPandora);
         delete pPandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MultiPandoraApiImpl::Registry &MultiPandoraApiImpl::GetRegistry() const
+{
+    // ATTN Each thread holds its own reference to the registry, so the hot path is a single atomic load unless the registry has changed
+    thread_local const MultiPandoraApiImpl *pCachedImpl(nullptr);
+    thread_local unsigned int cachedVersion(0);
+    thread_local RegistryPtr pCachedRegistry;
+
+    if ((this != pCachedImpl) || !pCachedRegistry || (m_version.load(std::memory_order_acquire) != cachedVersion))
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        pCachedImpl = this;
+        pCachedRegistry = m_pRegistry;
+        cachedVersion = m_version.load(std::memory_order_relaxed);
     }
+
+    return *pCachedRegistry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<MultiPandoraApiImpl::Registry> MultiPandoraApiImpl::CopyRegistry() const
+{
+    return std::make_shared<Registry>(*m_pRegistry);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MultiPandoraApiImpl::ReplaceRegistry(const RegistryPtr &pRegistry)
+{
+    m_pRegistry = pRegistry;
+    m_version.fetch_add(1, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MultiPandoraApiImpl::GetVolumeId(const Registry &registry, const pandora::Pandora *const pPandora, unsigned int &volumeId)
+{
+    PandoraToVolumeIdMap::const_iterator iter = registry.m_pandoraToVolumeIdMap.find(pPandora);
+
+    if (registry.m_pandoraToVolumeIdMap.end() == iter)
+        return false;
+
+    volumeId = iter->second;
+    return true;
 }
@@ -12,11 +12,16 @@
 
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 /**
- *  @brief  MultiPandoraApiImpl class
+ *  @brief  MultiPandoraApiImpl class. The relationships between pandora instances are held in an immutable registry, replaced as a whole
+ *          whenever instances are added or deleted. Lookups use a registry cached by each thread, and lock only to refresh the cache
+ *          after a change, so concurrent event processing in separate primary instances does not contend on a global lock.
  */
 class MultiPandoraApiImpl
 {
@@ -34,9 +39,18 @@ private:
     /**
      *  @brief  Get the pandora instance map
      *
-     *  @return the pandora instance map
+     *  @return a copy of the pandora instance map
      */
-    const PandoraInstanceMap &GetPandoraInstanceMap() const;
+    PandoraInstanceMap GetPandoraInstanceMap() const;
+
+    /**
+     *  @brief  Whether a pandora instance is a primary pandora instance
+     *
+     *  @param  pPandora the address of the pandora instance
+     *
+     *  @return boolean
+     */
+    bool IsPrimaryPandoraInstance(const pandora::Pandora *const pPandora) const;
 
     /**
      *  @brief  Get the address of the pandora instance associated with a given primary pandora instance and volume id number
@@ -53,9 +67,9 @@ private:
      *
      *  @param  pPrimaryPandora the address of the primary pandora instance
      *
-     *  @return the daughter pandora instance list
+     *  @return a copy of the daughter pandora instance list
      */
-    const PandoraInstanceList &GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const;
+    PandoraInstanceList GetDaughterPandoraInstanceList(const pandora::Pandora *const pPrimaryPandora) const;
 
     /**
      *  @brief  Get the address of the primary pandora instance associated with a given daughter pandora instance
@@ -108,9 +122,55 @@ private:
     typedef std::unordered_map<const pandora::Pandora *, const pandora::Pandora *> PandoraRelationMap;
     typedef std::unordered_map<const pandora::Pandora *, unsigned int> PandoraToVolumeIdMap;
 
-    PandoraInstanceMap m_primaryToDaughtersMap;  ///< The map from primary pandora instance to list of daughter pandora instances
-    PandoraRelationMap m_daughterToPrimaryMap;   ///< The map from daughter pandora instance to primary pandora instance
-    PandoraToVolumeIdMap m_pandoraToVolumeIdMap; ///< The map from pandora instance to volume id
+    /**
+     *  @brief  Registry class, holding the relationships between pandora instances
+     */
+    class Registry
+    {
+    public:
+        PandoraInstanceMap m_primaryToDaughtersMap;  ///< The map from primary pandora instance to list of daughter pandora instances
+        PandoraRelationMap m_daughterToPrimaryMap;   ///< The map from daughter pandora instance to primary pandora instance
+        PandoraToVolumeIdMap m_pandoraToVolumeIdMap; ///< The map from pandora instance to volume id
+    };
+
+    typedef std::shared_ptr<const Registry> RegistryPtr;
+
+    /**
+     *  @brief  Get the current registry, as cached by the calling thread. The reference remains valid until the calling thread next
+     *          calls this function after the registry has been replaced.
+     *
+     *  @return the registry
+     */
+    const Registry &GetRegistry() const;
+
+    /**
+     *  @brief  Get a modifiable copy of the current registry. Requires the mutex to be held.
+     *
+     *  @return the copy of the registry
+     */
+    std::shared_ptr<Registry> CopyRegistry() const;
+
+    /**
+     *  @brief  Replace the current registry. Requires the mutex to be held.
+     *
+     *  @param  pRegistry the new registry
+     */
+    void ReplaceRegistry(const RegistryPtr &pRegistry);
+
+    /**
+     *  @brief  Get the volume id associated with a given pandora instance
+     *
+     *  @param  registry the registry
+     *  @param  pPandora the address of the pandora instance
+     *  @param  volumeId to receive the volume id
+     *
+     *  @return whether a volume id is associated with the pandora instance
+     */
+    static bool GetVolumeId(const Registry &registry, const pandora::Pandora *const pPandora, unsigned int &volumeId);
+
+    mutable std::mutex m_mutex;          ///< The mutex protecting replacement of the registry
+    RegistryPtr m_pRegistry;             ///< The current registry
+    std::atomic<unsigned int> m_version; ///< The version of the current registry, incremented whenever the registry is replaced
 
     friend class MultiPandoraApi;
 };
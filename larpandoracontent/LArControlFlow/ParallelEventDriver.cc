@@ -0,0 +1,200 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ParallelEventDriver.cc
+ *
+ *  @brief  Implementation of the parallel event driver class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/Pandora.h"
+
+#include "larpandoracontent/LArContent.h"
+
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
+#include "larpandoracontent/LArControlFlow/ParallelEventDriver.h"
+
+#include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
+
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
+#include <iostream>
+#include <thread>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ParallelEventDriver::ParallelEventDriver(
+    const std::string &settingsFile, const unsigned int nSlots, const ContentRegistrationFunction &registerContent) :
+    m_nSlots(nSlots),
+    m_eventSequencer(nSlots),
+    m_shouldStop(false),
+    m_statusCode(STATUS_CODE_SUCCESS),
+    m_nEventsProcessed(0)
+{
+    for (unsigned int slotIndex = 0; slotIndex < m_nSlots; ++slotIndex)
+    {
+        const Pandora *const pPandora(new Pandora("ParallelEventDriverSlot" + std::to_string(slotIndex)));
+        MultiPandoraApi::AddPrimaryPandoraInstance(pPandora);
+        m_slotVector.emplace_back(pPandora);
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, registerContent(*pPandora));
+
+        // ATTN Each slot reads every n-th indexed event, matching the order in which the event sequencer deals out sequence numbers
+        EventReadingAlgorithm::ExternalEventReadingParameters *const pEventReadingParameters(
+            new EventReadingAlgorithm::ExternalEventReadingParameters);
+        pEventReadingParameters->m_nShards = m_nSlots;
+        pEventReadingParameters->m_shardIndex = slotIndex;
+        pEventReadingParameters->m_interleaveShards = true;
+        PANDORA_THROW_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraApi::SetExternalParameters(*pPandora, "LArEventReading", pEventReadingParameters));
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, settingsFile));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ParallelEventDriver::~ParallelEventDriver()
+{
+    for (const Slot &slot : m_slotVector)
+    {
+        EventSequencer::RemoveCurrentEvent(slot.m_pPandora);
+        MultiPandoraApi::DeletePandoraInstances(slot.m_pPandora);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ParallelEventDriver::ProcessEvents()
+{
+    std::vector<std::thread> threads;
+
+    for (unsigned int slotIndex = 0; slotIndex < m_nSlots; ++slotIndex)
+    {
+        if (!m_slotVector.at(slotIndex).m_isFinished)
+            threads.emplace_back(&ParallelEventDriver::ProcessSlotEvents, this, slotIndex);
+    }
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int ParallelEventDriver::GetNEventsProcessed() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nEventsProcessed;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ParallelEventDriver::RegisterLArContent(const Pandora &pandora)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(pandora));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(pandora));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new LArPseudoLayerPlugin));
+    PANDORA_RETURN_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(pandora, new LArRotationalTransformationPlugin));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ParallelEventDriver::Slot::Slot(const Pandora *const pPandora) :
+    m_pPandora(pPandora),
+    m_nEventsStarted(0),
+    m_isFinished(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParallelEventDriver::ProcessSlotEvents(const unsigned int slotIndex)
+{
+    while (!m_slotVector.at(slotIndex).m_isFinished)
+        this->ProcessNextEvent(slotIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParallelEventDriver::ProcessNextEvent(const unsigned int slotIndex)
+{
+    Slot &slot(m_slotVector.at(slotIndex));
+    const unsigned int sequenceNumber(slotIndex + slot.m_nEventsStarted * m_nSlots);
+
+    if (m_shouldStop)
+    {
+        m_eventSequencer.Finish(sequenceNumber);
+        slot.m_isFinished = true;
+        return;
+    }
+
+    ++slot.m_nEventsStarted;
+    EventSequencer::SetCurrentEvent(slot.m_pPandora, &m_eventSequencer, sequenceNumber);
+
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+    bool isEndOfInput(false);
+
+    try
+    {
+        statusCode = PandoraApi::ProcessEvent(*slot.m_pPandora);
+    }
+    catch (const StopProcessingException &)
+    {
+        isEndOfInput = true;
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        statusCode = statusCodeException.GetStatusCode();
+    }
+
+    EventSequencer::RemoveCurrentEvent(slot.m_pPandora);
+    const StatusCode resetStatusCode(PandoraApi::Reset(*slot.m_pPandora));
+
+    if (STATUS_CODE_SUCCESS == statusCode)
+        statusCode = resetStatusCode;
+
+    if (isEndOfInput || (STATUS_CODE_SUCCESS != statusCode))
+    {
+        if (!isEndOfInput)
+        {
+            std::cout << "ParallelEventDriver: slot " << slotIndex << " failed to process event " << sequenceNumber << ", "
+                      << StatusCodeToString(statusCode) << std::endl;
+            this->RecordFailure(statusCode);
+        }
+
+        m_eventSequencer.Finish(sequenceNumber);
+        slot.m_isFinished = true;
+        return;
+    }
+
+    m_eventSequencer.Complete(sequenceNumber);
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_nEventsProcessed;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParallelEventDriver::RecordFailure(const StatusCode statusCode)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (STATUS_CODE_SUCCESS == m_statusCode)
+        m_statusCode = statusCode;
+
+    m_shouldStop = true;
+}
+
+} // namespace lar_content
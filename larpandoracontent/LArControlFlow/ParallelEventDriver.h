@@ -0,0 +1,131 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ParallelEventDriver.h
+ *
+ *  @brief  Header file for the parallel event driver class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PARALLEL_EVENT_DRIVER_H
+#define LAR_PARALLEL_EVENT_DRIVER_H 1
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArControlFlow/EventSequencer.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ParallelEventDriver class, processing events concurrently using a number of independent primary Pandora instances, or slots,
+ *          each on its own thread. Each slot is configured using the same settings file, which should read events using LArEventReading
+ *          with an event index file; the driver deals the indexed events to the slots in turn. Output algorithms placed after
+ *          LArEventSequencing write their output in event order, whatever the number of slots.
+ */
+class ParallelEventDriver
+{
+public:
+    typedef std::function<pandora::StatusCode(const pandora::Pandora &)> ContentRegistrationFunction;
+
+    /**
+     *  @brief  Constructor, creating and configuring the pandora instance for each slot in turn
+     *
+     *  @param  settingsFile the pandora settings file for each slot
+     *  @param  nSlots the number of slots
+     *  @param  registerContent the function registering algorithms, algorithm tools and plugins with the pandora instance for each slot
+     */
+    ParallelEventDriver(const std::string &settingsFile, const unsigned int nSlots,
+        const ContentRegistrationFunction &registerContent = ParallelEventDriver::RegisterLArContent);
+
+    /**
+     *  @brief  Destructor, deleting the pandora instances for each slot, along with any worker instances they created
+     */
+    ~ParallelEventDriver();
+
+    /**
+     *  @brief  Process all events, with each slot processing its events on its own thread. Processing stops at the first failure.
+     *
+     *  @return success, or the status code of the first failure
+     */
+    pandora::StatusCode ProcessEvents();
+
+    /**
+     *  @brief  Get the number of events successfully processed
+     *
+     *  @return the number of events
+     */
+    unsigned int GetNEventsProcessed() const;
+
+    /**
+     *  @brief  Register the lar content algorithms, algorithm tools and plugins with a pandora instance
+     *
+     *  @param  pandora the pandora instance
+     */
+    static pandora::StatusCode RegisterLArContent(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  Slot class
+     */
+    class Slot
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pPandora address of the pandora instance
+         */
+        Slot(const pandora::Pandora *const pPandora);
+
+        const pandora::Pandora *m_pPandora; ///< Address of the pandora instance
+        unsigned int m_nEventsStarted;      ///< The number of events the slot has started to process, including any that failed
+        bool m_isFinished;                  ///< Whether the slot has no further events to process
+    };
+
+    typedef std::vector<Slot> SlotVector;
+
+    /**
+     *  @brief  Process all remaining events for a slot
+     *
+     *  @param  slotIndex the slot index
+     */
+    void ProcessSlotEvents(const unsigned int slotIndex);
+
+    /**
+     *  @brief  Process the next event for a slot, marking the slot as finished if it has no further events to process
+     *
+     *  @param  slotIndex the slot index
+     */
+    void ProcessNextEvent(const unsigned int slotIndex);
+
+    /**
+     *  @brief  Record a failure, requesting that all slots stop processing events
+     *
+     *  @param  statusCode the status code describing the failure
+     */
+    void RecordFailure(const pandora::StatusCode statusCode);
+
+    const unsigned int m_nSlots;      ///< The number of slots
+    SlotVector m_slotVector;          ///< The slots
+    EventSequencer m_eventSequencer;  ///< The event sequencer, ordering the output of the events processed by all slots
+    std::atomic<bool> m_shouldStop;   ///< Whether all slots should stop processing events
+    mutable std::mutex m_mutex;       ///< The mutex protecting the status code and the event count
+    pandora::StatusCode m_statusCode; ///< The status code of the first failure, if any
+    unsigned int m_nEventsProcessed;  ///< The number of events successfully processed
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PARALLEL_EVENT_DRIVER_H
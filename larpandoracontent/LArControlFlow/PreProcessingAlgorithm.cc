@@ -198,10 +198,11 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
     for (const CaloHit *const pCaloHit1 : inputList)
     {
         bool isUnique(true);
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit1, m_searchRegion1D, m_searchRegion1D));
+        const HitKDNode2D searchPoint(pCaloHit1, pCaloHit1->GetPositionVector().GetX(), pCaloHit1->GetPositionVector().GetZ());
 
+        // ATTN Duplicates lie within numerical precision of one another, so are all found within a radius of the search region size
         HitKDNode2DList found;
-        kdTree.search(searchRegionHits, found);
+        kdTree.findNeighboursWithinRadius(searchPoint, m_searchRegion1D, found);
 
         for (const auto &hit : found)
         {
@@ -139,9 +139,81 @@ void StitchingCosmicRayMergingTool::BuildTPCMaps(const PfoList &inputPfoList, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void StitchingCosmicRayMergingTool::BuildEndpointIndices(const LArTPCToPfoMap &larTPCToPfoMap,
+    const ThreeDPointingClusterMap &pointingClusterMap, LArTPCToEndpointIndexMap &larTPCToEndpointIndexMap) const
+{
+    for (const auto &mapEntry : larTPCToPfoMap)
+    {
+        TPCEndpointIndex &endpointIndex(larTPCToEndpointIndexMap[mapEntry.first]);
+
+        for (const ParticleFlowObject *const pPfo : mapEntry.second)
+        {
+            ThreeDPointingClusterMap::const_iterator iter(pointingClusterMap.find(pPfo));
+
+            if (pointingClusterMap.end() == iter)
+                continue;
+
+            const LArPointingCluster &pointingCluster(iter->second);
+
+            // Check length of pointing cluster
+            if (pointingCluster.GetLengthSquared() < m_minLengthSquared)
+                continue;
+
+            // Check number of 3D hits in the pfo
+            CaloHitList caloHitList3D;
+            LArPfoHelper::GetCaloHits(pPfo, TPC_3D, caloHitList3D);
+
+            if (caloHitList3D.size() < m_minNCaloHits3D)
+                continue;
+
+            // Pointing cluster must have an extent in x, so that the vertex closest to each tpc boundary can be identified
+            const float innerX(pointingCluster.GetInnerVertex().GetPosition().GetX());
+            const float outerX(pointingCluster.GetOuterVertex().GetPosition().GetX());
+
+            if (std::fabs(outerX - innerX) < std::numeric_limits<float>::epsilon())
+                continue;
+
+            const unsigned int pfoPosition(endpointIndex.m_pfoVector.size());
+            endpointIndex.m_pfoVector.push_back(pPfo);
+            endpointIndex.m_lowXCoords.push_back(std::min(innerX, outerX));
+            endpointIndex.m_highXCoords.push_back(std::max(innerX, outerX));
+            endpointIndex.m_lowXEndpoints.emplace_back(std::min(innerX, outerX), pfoPosition);
+            endpointIndex.m_highXEndpoints.emplace_back(std::max(innerX, outerX), pfoPosition);
+        }
+
+        std::sort(endpointIndex.m_lowXEndpoints.begin(), endpointIndex.m_lowXEndpoints.end());
+        std::sort(endpointIndex.m_highXEndpoints.begin(), endpointIndex.m_highXEndpoints.end());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::GetCandidatePfoPositions(const PfoEndpointVector &endpoints, const float x, const float boundaryCenterX,
+    const float maxLongitudinalDisplacementX, PfoPositionVector &pfoPositions) const
+{
+    // ATTN Pfo pairs must satisfy |0.5 * (x + x2) - boundaryCenterX| <= maxLongitudinalDisplacementX, tolerance allows for rounding
+    const float tolerance(1.f + 1.e-3f * (std::fabs(x) + std::fabs(boundaryCenterX) + std::fabs(maxLongitudinalDisplacementX)));
+    const float minX2(2.f * (boundaryCenterX - maxLongitudinalDisplacementX) - x - tolerance);
+    const float maxX2(2.f * (boundaryCenterX + maxLongitudinalDisplacementX) - x + tolerance);
+
+    PfoEndpointVector::const_iterator beginIter(std::lower_bound(endpoints.begin(), endpoints.end(), PfoEndpoint(minX2, 0)));
+    PfoEndpointVector::const_iterator endIter(
+        std::upper_bound(beginIter, endpoints.end(), PfoEndpoint(maxX2, std::numeric_limits<unsigned int>::max())));
+
+    for (PfoEndpointVector::const_iterator iter = beginIter; iter != endIter; ++iter)
+        pfoPositions.push_back(iter->second);
+
+    std::sort(pfoPositions.begin(), pfoPositions.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap,
     const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
 {
+    LArTPCToEndpointIndexMap larTPCToEndpointIndexMap;
+    this->BuildEndpointIndices(larTPCToPfoMap, pointingClusterMap, larTPCToEndpointIndexMap);
+
     LArTPCVector larTPCVector;
     for (const auto &mapEntry : larTPCToPfoMap)
         larTPCVector.push_back(mapEntry.first);
@@ -150,20 +222,36 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
     for (LArTPCVector::const_iterator tpcIter1 = larTPCVector.begin(), tpcIterEnd = larTPCVector.end(); tpcIter1 != tpcIterEnd; ++tpcIter1)
     {
         const LArTPC *const pLArTPC1(*tpcIter1);
-        const PfoList &pfoList1(larTPCToPfoMap.at(pLArTPC1));
+        const TPCEndpointIndex &endpointIndex1(larTPCToEndpointIndexMap.at(pLArTPC1));
 
         for (LArTPCVector::const_iterator tpcIter2 = tpcIter1; tpcIter2 != tpcIterEnd; ++tpcIter2)
         {
             const LArTPC *const pLArTPC2(*tpcIter2);
-            const PfoList &pfoList2(larTPCToPfoMap.at(pLArTPC2));
+            const TPCEndpointIndex &endpointIndex2(larTPCToEndpointIndexMap.at(pLArTPC2));
 
             if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
                 continue;
 
-            for (const ParticleFlowObject *const pPfo1 : pfoList1)
+            // Only the vertices closest to the shared boundary can be associated, these being the endpoints facing the other tpc
+            const bool isTPC2AtHigherX(pLArTPC2->GetCenterX() - pLArTPC1->GetCenterX() > 0.f);
+            const FloatVector &xCoords1(isTPC2AtHigherX ? endpointIndex1.m_highXCoords : endpointIndex1.m_lowXCoords);
+            const PfoEndpointVector &endpoints2(isTPC2AtHigherX ? endpointIndex2.m_lowXEndpoints : endpointIndex2.m_highXEndpoints);
+
+            const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(*pLArTPC1, *pLArTPC2));
+            const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(*pLArTPC1, *pLArTPC2));
+            const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
+
+            for (unsigned int pfoPosition1 = 0; pfoPosition1 < endpointIndex1.m_pfoVector.size(); ++pfoPosition1)
             {
-                for (const ParticleFlowObject *const pPfo2 : pfoList2)
-                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pPfo1, pPfo2, pointingClusterMap, pfoAssociationMatrix);
+                PfoPositionVector pfoPositions2;
+                this->GetCandidatePfoPositions(
+                    endpoints2, xCoords1.at(pfoPosition1), boundaryCenterX, maxLongitudinalDisplacementX, pfoPositions2);
+
+                for (const unsigned int pfoPosition2 : pfoPositions2)
+                {
+                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, endpointIndex1.m_pfoVector.at(pfoPosition1),
+                        endpointIndex2.m_pfoVector.at(pfoPosition2), pointingClusterMap, pfoAssociationMatrix);
+                }
             }
         }
     }
@@ -189,20 +277,7 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, cons
     const LArPointingCluster &pointingCluster1(iter1->second);
     const LArPointingCluster &pointingCluster2(iter2->second);
 
-    // Check length of pointing clusters
-    if (pointingCluster1.GetLengthSquared() < m_minLengthSquared || pointingCluster2.GetLengthSquared() < m_minLengthSquared)
-        return;
-
-    // Get number of 3D hits in each of the pfos
-    CaloHitList caloHitList3D1;
-    LArPfoHelper::GetCaloHits(pPfo1, TPC_3D, caloHitList3D1);
-
-    CaloHitList caloHitList3D2;
-    LArPfoHelper::GetCaloHits(pPfo2, TPC_3D, caloHitList3D2);
-
-    // Check number of 3D hits in each of the pfos
-    if (caloHitList3D1.size() < m_minNCaloHits3D || caloHitList3D2.size() < m_minNCaloHits3D)
-        return;
+    // ATTN Length and number of 3D hits for each pfo are checked once, when building the tpc endpoint indices
 
     // Get closest pair of vertices
     LArPointingCluster::Vertex pointingVertex1, pointingVertex2;
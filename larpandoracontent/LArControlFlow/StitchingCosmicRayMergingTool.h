@@ -118,6 +118,48 @@ private:
      */
     void BuildTPCMaps(const pandora::PfoList &inputPfoList, const PfoToLArTPCMap &pfoToLArTPCMap, LArTPCToPfoMap &larTPCToPfoMap) const;
 
+    typedef std::pair<float, unsigned int> PfoEndpoint; ///< The x coordinate of a pfo endpoint and the position of the pfo in its tpc index
+    typedef std::vector<PfoEndpoint> PfoEndpointVector;
+    typedef std::vector<unsigned int> PfoPositionVector;
+
+    /**
+     *  @brief  TPCEndpointIndex class, indexing the endpoints of the pfos in a tpc by the tpc boundary face towards which they point
+     */
+    class TPCEndpointIndex
+    {
+    public:
+        pandora::PfoVector m_pfoVector;     ///< The pfos that could be stitched, in the order of the tpc pfo list
+        pandora::FloatVector m_lowXCoords;  ///< The x coordinate of the low-x endpoint of each pfo
+        pandora::FloatVector m_highXCoords; ///< The x coordinate of the high-x endpoint of each pfo
+        PfoEndpointVector m_lowXEndpoints;  ///< The low-x endpoints, facing the neighbouring tpc at lower x, sorted by x coordinate
+        PfoEndpointVector m_highXEndpoints; ///< The high-x endpoints, facing the neighbouring tpc at higher x, sorted by x coordinate
+    };
+
+    typedef std::unordered_map<const pandora::LArTPC *, TPCEndpointIndex> LArTPCToEndpointIndexMap;
+
+    /**
+     *  @brief  Build an endpoint index for each tpc, holding the pfos that pass the single-pfo requirements for association
+     *
+     *  @param  larTPCToPfoMap the input mapping between tpc and Pfos
+     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  larTPCToEndpointIndexMap the output mapping between tpc and endpoint indices
+     */
+    void BuildEndpointIndices(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
+        LArTPCToEndpointIndexMap &larTPCToEndpointIndexMap) const;
+
+    /**
+     *  @brief  Get the positions of the pfos with an endpoint that could be consistent with an intersection, with a given endpoint,
+     *          at a tpc boundary. The selection is conservative, the precise requirement being applied to each resulting pfo pair.
+     *
+     *  @param  endpoints the sorted endpoints facing the tpc boundary
+     *  @param  x the x coordinate of the given endpoint
+     *  @param  boundaryCenterX the x coordinate of the centre of the tpc boundary
+     *  @param  maxLongitudinalDisplacementX the maximum displacement of the intersection from the boundary centre
+     *  @param  pfoPositions to receive the positions of the pfos in the tpc index, in increasing order
+     */
+    void GetCandidatePfoPositions(const PfoEndpointVector &endpoints, const float x, const float boundaryCenterX,
+        const float maxLongitudinalDisplacementX, PfoPositionVector &pfoPositions) const;
+
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoAssociation> PfoAssociationMap;
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoAssociationMap> PfoAssociationMatrix;
 
@@ -132,7 +174,7 @@ private:
         PfoAssociationMatrix &pfoAssociationMatrix) const;
 
     /**
-     *  @brief  Create associations between Pfos using 3D pointing clusters
+     *  @brief  Create associations between Pfos using 3D pointing clusters, for Pfos already passing the single-pfo requirements
      *
      *  @param  larTPC1 the tpc description for the first Pfo
      *  @param  larTPC2 the tpc description for the second Pfo
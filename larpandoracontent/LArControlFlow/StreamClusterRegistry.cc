@@ -0,0 +1,71 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/StreamClusterRegistry.cc
+ *
+ *  @brief  Implementation of the stream cluster registry class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArControlFlow/StreamClusterRegistry.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+std::mutex StreamClusterRegistry::m_mutex;
+StreamClusterRegistry::EntryMap StreamClusterRegistry::m_entryMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StreamClusterRegistry::SetInputClusters(const Pandora *const pWorkerPandora, const ClusterHitsVector &clusterHitsVector)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entryMap[pWorkerPandora].m_inputClusters = clusterHitsVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StreamClusterRegistry::GetInputClusters(const Pandora *const pWorkerPandora, ClusterHitsVector &clusterHitsVector)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    EntryMap::const_iterator iter(m_entryMap.find(pWorkerPandora));
+
+    if (m_entryMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    clusterHitsVector = iter->second.m_inputClusters;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StreamClusterRegistry::SetOutputClusters(const Pandora *const pWorkerPandora, const ClusterHitsVector &clusterHitsVector)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entryMap[pWorkerPandora].m_outputClusters = clusterHitsVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StreamClusterRegistry::GetOutputClusters(const Pandora *const pWorkerPandora, ClusterHitsVector &clusterHitsVector)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    EntryMap::const_iterator iter(m_entryMap.find(pWorkerPandora));
+
+    if (m_entryMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    clusterHitsVector = iter->second.m_outputClusters;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StreamClusterRegistry::Reset(const Pandora *const pWorkerPandora)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entryMap.erase(pWorkerPandora);
+}
+
+} // namespace lar_content
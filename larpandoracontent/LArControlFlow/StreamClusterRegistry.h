@@ -0,0 +1,104 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/StreamClusterRegistry.h
+ *
+ *  @brief  Header file for the stream cluster registry class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_STREAM_CLUSTER_REGISTRY_H
+#define LAR_STREAM_CLUSTER_REGISTRY_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  StreamClusterRegistry class, used to pass cluster hit groupings between a parent Pandora instance and its stream worker
+ *          instances. Each worker instance owns a single entry, so workers may access the registry concurrently.
+ */
+class StreamClusterRegistry
+{
+public:
+    /**
+     *  @brief  ClusterHits class, describing the hits in a single cluster, identified by the addresses of the hits in the parent instance
+     */
+    class ClusterHits
+    {
+    public:
+        pandora::CaloHitList m_caloHitList;         ///< The (non-isolated) hits in the cluster
+        pandora::CaloHitList m_isolatedCaloHitList; ///< The isolated hits in the cluster
+    };
+
+    typedef std::vector<ClusterHits> ClusterHitsVector;
+
+    /**
+     *  @brief  Set the input clusters for a worker instance, replacing any existing input clusters
+     *
+     *  @param  pWorkerPandora address of the worker pandora instance
+     *  @param  clusterHitsVector the input clusters
+     */
+    static void SetInputClusters(const pandora::Pandora *const pWorkerPandora, const ClusterHitsVector &clusterHitsVector);
+
+    /**
+     *  @brief  Get the input clusters for a worker instance
+     *
+     *  @param  pWorkerPandora address of the worker pandora instance
+     *  @param  clusterHitsVector to receive the input clusters
+     */
+    static void GetInputClusters(const pandora::Pandora *const pWorkerPandora, ClusterHitsVector &clusterHitsVector);
+
+    /**
+     *  @brief  Set the output clusters for a worker instance, replacing any existing output clusters
+     *
+     *  @param  pWorkerPandora address of the worker pandora instance
+     *  @param  clusterHitsVector the output clusters
+     */
+    static void SetOutputClusters(const pandora::Pandora *const pWorkerPandora, const ClusterHitsVector &clusterHitsVector);
+
+    /**
+     *  @brief  Get the output clusters for a worker instance
+     *
+     *  @param  pWorkerPandora address of the worker pandora instance
+     *  @param  clusterHitsVector to receive the output clusters
+     */
+    static void GetOutputClusters(const pandora::Pandora *const pWorkerPandora, ClusterHitsVector &clusterHitsVector);
+
+    /**
+     *  @brief  Remove all input and output clusters registered for a worker instance
+     *
+     *  @param  pWorkerPandora address of the worker pandora instance
+     */
+    static void Reset(const pandora::Pandora *const pWorkerPandora);
+
+private:
+    /**
+     *  @brief  Entry class, holding the input and output clusters for a single worker instance
+     */
+    class Entry
+    {
+    public:
+        ClusterHitsVector m_inputClusters;  ///< The input clusters
+        ClusterHitsVector m_outputClusters; ///< The output clusters
+    };
+
+    typedef std::unordered_map<const pandora::Pandora *, Entry> EntryMap;
+
+    static std::mutex m_mutex;  ///< The mutex protecting the entry map
+    static EntryMap m_entryMap; ///< The map from worker pandora instance to registry entry
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_STREAM_CLUSTER_REGISTRY_H
@@ -0,0 +1,80 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/StreamWorkerInputAlgorithm.cc
+ *
+ *  @brief  Implementation of the stream worker input algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArControlFlow/StreamClusterRegistry.h"
+#include "larpandoracontent/LArControlFlow/StreamWorkerInputAlgorithm.h"
+
+#include <unordered_map>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+StreamWorkerInputAlgorithm::StreamWorkerInputAlgorithm()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamWorkerInputAlgorithm::Run()
+{
+    StreamClusterRegistry::ClusterHitsVector inputClusters;
+    StreamClusterRegistry::GetInputClusters(&this->GetPandora(), inputClusters);
+
+    if (inputClusters.empty())
+        return STATUS_CODE_SUCCESS;
+
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    // ATTN Hits are copied into the worker instance with their parent address set to the address of the original hit
+    std::unordered_map<const CaloHit *, const CaloHit *> parentToWorkerHitMap;
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+        (void)parentToWorkerHitMap.insert(std::make_pair(static_cast<const CaloHit *>(pCaloHit->GetParentAddress()), pCaloHit));
+
+    const ClusterList *pTemporaryList(nullptr);
+    std::string temporaryListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pTemporaryList, temporaryListName));
+
+    for (const StreamClusterRegistry::ClusterHits &clusterHits : inputClusters)
+    {
+        PandoraContentApi::Cluster::Parameters parameters;
+
+        for (const CaloHit *const pParentCaloHit : clusterHits.m_caloHitList)
+            parameters.m_caloHitList.push_back(parentToWorkerHitMap.at(pParentCaloHit));
+
+        for (const CaloHit *const pParentCaloHit : clusterHits.m_isolatedCaloHitList)
+            parameters.m_isolatedCaloHitList.push_back(parentToWorkerHitMap.at(pParentCaloHit));
+
+        if (parameters.m_caloHitList.empty() && parameters.m_isolatedCaloHitList.empty())
+            continue;
+
+        const Cluster *pCluster(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Cluster>(*this, m_outputClusterListName));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ReplaceCurrentList<Cluster>(*this, m_outputClusterListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamWorkerInputAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputClusterListName", m_outputClusterListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,36 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/StreamWorkerInputAlgorithm.h
+ *
+ *  @brief  Header file for the stream worker input algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_STREAM_WORKER_INPUT_ALGORITHM_H
+#define LAR_STREAM_WORKER_INPUT_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  StreamWorkerInputAlgorithm class, recreating within a stream worker instance the clusters registered by the parent instance
+ */
+class StreamWorkerInputAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    StreamWorkerInputAlgorithm();
+
+private:
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    std::string m_outputClusterListName; ///< The name of the output cluster list, which will be set as the current list
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_STREAM_WORKER_INPUT_ALGORITHM_H
@@ -0,0 +1,71 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/StreamWorkerOutputAlgorithm.cc
+ *
+ *  @brief  Implementation of the stream worker output algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArControlFlow/StreamClusterRegistry.h"
+#include "larpandoracontent/LArControlFlow/StreamWorkerOutputAlgorithm.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+StreamWorkerOutputAlgorithm::StreamWorkerOutputAlgorithm()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamWorkerOutputAlgorithm::Run()
+{
+    const ClusterList *pClusterList(nullptr);
+    const StatusCode statusCode(m_inputClusterListName.empty() ? PandoraContentApi::GetCurrentList(*this, pClusterList)
+                                                               : PandoraContentApi::GetList(*this, m_inputClusterListName, pClusterList));
+
+    if ((STATUS_CODE_SUCCESS != statusCode) && (STATUS_CODE_NOT_INITIALIZED != statusCode))
+        return statusCode;
+
+    StreamClusterRegistry::ClusterHitsVector outputClusters;
+
+    if (pClusterList)
+    {
+        for (const Cluster *const pCluster : *pClusterList)
+        {
+            CaloHitList caloHitList;
+            pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+            // ATTN Report the addresses of the original hits, owned by the parent instance
+            StreamClusterRegistry::ClusterHits clusterHits;
+
+            for (const CaloHit *const pCaloHit : caloHitList)
+                clusterHits.m_caloHitList.push_back(static_cast<const CaloHit *>(pCaloHit->GetParentAddress()));
+
+            for (const CaloHit *const pCaloHit : pCluster->GetIsolatedCaloHitList())
+                clusterHits.m_isolatedCaloHitList.push_back(static_cast<const CaloHit *>(pCaloHit->GetParentAddress()));
+
+            outputClusters.push_back(clusterHits);
+        }
+    }
+
+    StreamClusterRegistry::SetOutputClusters(&this->GetPandora(), outputClusters);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamWorkerOutputAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName", m_inputClusterListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
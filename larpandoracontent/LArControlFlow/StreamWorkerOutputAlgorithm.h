@@ -0,0 +1,36 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/StreamWorkerOutputAlgorithm.h
+ *
+ *  @brief  Header file for the stream worker output algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_STREAM_WORKER_OUTPUT_ALGORITHM_H
+#define LAR_STREAM_WORKER_OUTPUT_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  StreamWorkerOutputAlgorithm class, registering the clusters produced by a stream worker instance for collection by the parent
+ */
+class StreamWorkerOutputAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    StreamWorkerOutputAlgorithm();
+
+private:
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    std::string m_inputClusterListName; ///< The name of the input cluster list, if not using the current list
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_STREAM_WORKER_OUTPUT_ALGORITHM_H
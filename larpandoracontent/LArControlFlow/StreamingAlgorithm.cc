@@ -6,24 +6,38 @@
  *  $Log: $
  */
 
+#include "Api/PandoraApi.h"
+
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArContent.h"
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 #include "larpandoracontent/LArControlFlow/StreamingAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include <algorithm>
 #include <numeric>
+#include <thread>
 
 using namespace pandora;
 
 namespace lar_content
 {
 
-StreamingAlgorithm::StreamingAlgorithm() : m_listType{"cluster"}
+StreamingAlgorithm::StreamingAlgorithm() :
+    m_listType{"cluster"},
+    m_runStreamsConcurrently{false},
+    m_filePathEnvironmentVariable{"FW_SEARCH_PATH"}
 {
 }
 
@@ -31,16 +45,99 @@ StreamingAlgorithm::StreamingAlgorithm() : m_listType{"cluster"}
 
 StreamingAlgorithm::~StreamingAlgorithm()
 {
+    // ATTN The worker instances themselves are deleted along with the primary pandora instance, via the multi pandora api
+    for (const Pandora *const pWorkerPandora : m_workerInstances)
+        StreamClusterRegistry::Reset(pWorkerPandora);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode StreamingAlgorithm::Run()
+{
+    if (m_runStreamsConcurrently)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunStreamsConcurrently());
+    }
+    else
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunStreamsSerially());
+    }
+
+    // If we have a single output list specified, set that list as the current list
+    if (!m_outputListName.empty())
+        PandoraContentApi::ReplaceCurrentList<Cluster>(*this, m_outputListName);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::Reset()
+{
+    for (const Pandora *const pWorkerPandora : m_workerInstances)
+    {
+        StreamClusterRegistry::Reset(pWorkerPandora);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pWorkerPandora));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::InitializeWorkerInstances()
+{
+    if (!m_workerInstances.empty())
+        return STATUS_CODE_ALREADY_INITIALIZED;
+
+    try
+    {
+        for (unsigned int i = 0; i < m_inputListNames.size(); ++i)
+            m_workerInstances.push_back(this->CreateWorkerInstance(m_streamSettingsFiles.at(i), "StreamWorker" + m_inputListNames.at(i)));
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "StreamingAlgorithm: Exception during initialization of worker instances " << statusCodeException.ToString()
+                  << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::RunStreamsSerially()
 {
     unsigned int i{0};
     for (std::string listName : m_inputListNames)
     {
         std::string algStreamName{"Algorithms" + listName};
+
+        if (m_listType == "calohit")
+        {
+            // Set the input hit list as current, with the stream algorithms creating the clusters
+            const CaloHitList *pCaloHitList{nullptr};
+            PandoraContentApi::ReplaceCurrentList<CaloHit>(*this, listName);
+            StatusCode code{PandoraContentApi::GetCurrentList(*this, pCaloHitList)};
+            if (code == STATUS_CODE_SUCCESS)
+            {
+                if (!pCaloHitList->empty())
+                {
+                    for (const auto &alg : m_streamAlgorithmMap.at(algStreamName))
+                        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, alg));
+
+                    PandoraContentApi::SaveList<Cluster>(*this, m_outputListName.empty() ? m_outputListNames.at(i) : m_outputListName);
+                }
+            }
+            else if (code != STATUS_CODE_NOT_INITIALIZED)
+            {
+                return code;
+            }
+            ++i;
+            continue;
+        }
+
         const ClusterList *pClusterList{nullptr};
         // Set the input list as current
         PandoraContentApi::ReplaceCurrentList<Cluster>(*this, listName);
@@ -68,10 +165,221 @@ StatusCode StreamingAlgorithm::Run()
         ++i;
     }
 
-    // If we have a single output list specified, set that list as the current list
-    if (!m_outputListName.empty())
-        PandoraContentApi::ReplaceCurrentList<Cluster>(*this, m_outputListName);
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::RunStreamsConcurrently()
+{
+    if (m_workerInstances.empty())
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->InitializeWorkerInstances());
+    }
+
+    // ATTN Pandora instances are not thread safe, so this instance is only accessed before the workers start and after they finish
+    const unsigned int nStreams(m_inputListNames.size());
+    std::vector<bool> hasInputList(nStreams, false), isActiveStream(nStreams, false);
 
+    for (unsigned int i = 0; i < nStreams; ++i)
+    {
+        CaloHitList caloHitList;
+        StreamClusterRegistry::ClusterHitsVector inputClusters;
+        const StatusCode code{this->GetStreamInput(m_inputListNames.at(i), caloHitList, inputClusters)};
+
+        if (code == STATUS_CODE_NOT_INITIALIZED)
+            continue;
+
+        if (code != STATUS_CODE_SUCCESS)
+            return code;
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyToWorkerInstance(caloHitList, inputClusters, m_workerInstances.at(i)));
+        hasInputList.at(i) = true;
+        isActiveStream.at(i) = !caloHitList.empty();
+    }
+
+    std::vector<StatusCode> streamStatusCodes(nStreams, STATUS_CODE_SUCCESS);
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 0; i < nStreams; ++i)
+    {
+        if (!isActiveStream.at(i))
+            continue;
+
+        threads.emplace_back(
+            [this, i, &streamStatusCodes]()
+            {
+                try
+                {
+                    streamStatusCodes.at(i) = PandoraApi::ProcessEvent(*m_workerInstances.at(i));
+                }
+                catch (const StatusCodeException &statusCodeException)
+                {
+                    streamStatusCodes.at(i) = statusCodeException.GetStatusCode();
+                }
+            });
+    }
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    // Collect the output in stream order, so that the output lists match those of the serial mode
+    for (unsigned int i = 0; i < nStreams; ++i)
+    {
+        if (STATUS_CODE_SUCCESS != streamStatusCodes.at(i))
+        {
+            std::cout << "StreamingAlgorithm: Stream " << m_inputListNames.at(i) << " failed with "
+                      << StatusCodeToString(streamStatusCodes.at(i)) << std::endl;
+            return streamStatusCodes.at(i);
+        }
+
+        if (!hasInputList.at(i))
+            continue;
+
+        const std::string &outputListName(m_outputListName.empty() ? m_outputListNames.at(i) : m_outputListName);
+
+        if (isActiveStream.at(i))
+        {
+            PANDORA_RETURN_RESULT_IF(
+                STATUS_CODE_SUCCESS, !=, this->CollectFromWorkerInstance(m_inputListNames.at(i), outputListName, m_workerInstances.at(i)));
+        }
+        else if (m_listType == "cluster")
+        {
+            PandoraContentApi::ReplaceCurrentList<Cluster>(*this, m_inputListNames.at(i));
+            PandoraContentApi::SaveList<Cluster>(*this, outputListName);
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::GetStreamInput(
+    const std::string &inputListName, CaloHitList &caloHitList, StreamClusterRegistry::ClusterHitsVector &inputClusters) const
+{
+    if (m_listType == "calohit")
+    {
+        const CaloHitList *pCaloHitList{nullptr};
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, inputListName, pCaloHitList));
+        caloHitList = *pCaloHitList;
+        return STATUS_CODE_SUCCESS;
+    }
+
+    const ClusterList *pClusterList{nullptr};
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, inputListName, pClusterList));
+
+    for (const Cluster *const pCluster : *pClusterList)
+    {
+        StreamClusterRegistry::ClusterHits clusterHits;
+        pCluster->GetOrderedCaloHitList().FillCaloHitList(clusterHits.m_caloHitList);
+        clusterHits.m_isolatedCaloHitList = pCluster->GetIsolatedCaloHitList();
+        caloHitList.insert(caloHitList.end(), clusterHits.m_caloHitList.begin(), clusterHits.m_caloHitList.end());
+        caloHitList.insert(caloHitList.end(), clusterHits.m_isolatedCaloHitList.begin(), clusterHits.m_isolatedCaloHitList.end());
+        inputClusters.push_back(clusterHits);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::CopyToWorkerInstance(const CaloHitList &caloHitList,
+    const StreamClusterRegistry::ClusterHitsVector &inputClusters, const Pandora *const pWorkerPandora) const
+{
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
+        if (pLArCaloHit == nullptr)
+        {
+            std::cout << "StreamingAlgorithm: Could not cast CaloHit to LArCaloHit" << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+        LArCaloHitParameters parameters;
+        pLArCaloHit->FillParameters(parameters);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pWorkerPandora, parameters, m_larCaloHitFactory));
+    }
+
+    StreamClusterRegistry::SetInputClusters(pWorkerPandora, inputClusters);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::CollectFromWorkerInstance(
+    const std::string &inputListName, const std::string &outputListName, const Pandora *const pWorkerPandora) const
+{
+    StreamClusterRegistry::ClusterHitsVector outputClusters;
+    StreamClusterRegistry::GetOutputClusters(pWorkerPandora, outputClusters);
+
+    if (m_listType == "cluster")
+    {
+        // ATTN The worker output clusters replace the input clusters, so the input clusters must first release their hits
+        const ClusterList *pInputClusterList{nullptr};
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, inputListName, pInputClusterList));
+
+        const ClusterList inputClusterList(*pInputClusterList);
+
+        for (const Cluster *const pCluster : inputClusterList)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete<Cluster>(*this, pCluster, inputListName));
+    }
+
+    const ClusterList *pTemporaryList{nullptr};
+    std::string temporaryListName;
+    PANDORA_RETURN_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pTemporaryList, temporaryListName));
+
+    for (const StreamClusterRegistry::ClusterHits &clusterHits : outputClusters)
+    {
+        PandoraContentApi::Cluster::Parameters parameters;
+        parameters.m_caloHitList = clusterHits.m_caloHitList;
+        parameters.m_isolatedCaloHitList = clusterHits.m_isolatedCaloHitList;
+
+        if (parameters.m_caloHitList.empty() && parameters.m_isolatedCaloHitList.empty())
+            continue;
+
+        const Cluster *pCluster{nullptr};
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+    }
+
+    if (!pTemporaryList->empty())
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Cluster>(*this, outputListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Pandora *StreamingAlgorithm::CreateWorkerInstance(const std::string &settingsFile, const std::string &name) const
+{
+    // ATTN This algorithm may itself run within a worker instance, so the stream workers are registered with the primary instance
+    const Pandora *const pThisPandora(&(this->GetPandora()));
+    const Pandora *const pPrimaryPandora(
+        MultiPandoraApi::IsPrimaryPandoraInstance(pThisPandora) ? pThisPandora : MultiPandoraApi::GetPrimaryPandoraInstance(pThisPandora));
+
+    // The Pandora instance
+    const Pandora *const pPandora(new Pandora(name));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new lar_content::LArPseudoLayerPlugin));
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new lar_content::LArRotationalTransformationPlugin));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RegisterCustomContent(pPandora));
+    MultiPandoraApi::AddDaughterPandoraInstance(pPrimaryPandora, pPandora);
+
+    // The geometry, matching that of this instance
+    LArGeometryHelper::CopyGeometry(this->GetPandora(), *pPandora);
+
+    // Configuration
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, settingsFile));
+    return pPandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode StreamingAlgorithm::RegisterCustomContent(const Pandora *const /*pPandora*/) const
+{
     return STATUS_CODE_SUCCESS;
 }
 
@@ -81,9 +389,9 @@ StatusCode StreamingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ListType", m_listType));
     std::transform(m_listType.begin(), m_listType.end(), m_listType.begin(), ::tolower);
-    if (m_listType != "cluster")
+    if (m_listType != "cluster" && m_listType != "calohit")
     {
-        std::cout << "StreamingAlgorithm::ReadSettings - Error: Only Cluster list type is supported at this time" << std::endl;
+        std::cout << "StreamingAlgorithm::ReadSettings - Error: Only Cluster and CaloHit list types are supported" << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
     }
 
@@ -110,20 +418,44 @@ StatusCode StreamingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         return STATUS_CODE_INVALID_PARAMETER;
     }
 
-    for (std::string listName : m_inputListNames)
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "RunStreamsConcurrently", m_runStreamsConcurrently));
+
+    if (m_runStreamsConcurrently)
     {
-        std::string algStreamName{"Algorithms" + listName};
-        if (m_streamAlgorithmMap.find(algStreamName) != m_streamAlgorithmMap.end())
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "StreamSettingsFiles", m_streamSettingsFiles));
+        if (m_inputListNames.size() != m_streamSettingsFiles.size())
         {
-            std::cout << "StreamingAlgorithm::ReadSettings - Error: Duplicate stream name found" << std::endl;
+            std::cout << "StreamingAlgorithm::ReadSettings - Error: When running streams concurrently, there should be one settings file "
+                      << "per input list" << std::endl;
             return STATUS_CODE_INVALID_PARAMETER;
         }
-        PANDORA_RETURN_RESULT_IF(
-            STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, algStreamName, m_streamAlgorithmMap[algStreamName]));
-        if (m_streamAlgorithmMap.at(algStreamName).empty())
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
+
+        for (std::string &settingsFile : m_streamSettingsFiles)
+            settingsFile = LArFileHelper::FindFileInPath(settingsFile, m_filePathEnvironmentVariable);
+    }
+    else
+    {
+        // ATTN Only needed when running serially, otherwise the stream algorithms are specified in the worker instance settings files
+        for (std::string listName : m_inputListNames)
         {
-            std::cout << "StreamingAlgorithm::ReadSettings - Error: Found no algorithms for \'" << algStreamName << "\'" << std::endl;
-            return STATUS_CODE_NOT_FOUND;
+            std::string algStreamName{"Algorithms" + listName};
+            if (m_streamAlgorithmMap.find(algStreamName) != m_streamAlgorithmMap.end())
+            {
+                std::cout << "StreamingAlgorithm::ReadSettings - Error: Duplicate stream name found" << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                XmlHelper::ProcessAlgorithmList(*this, xmlHandle, algStreamName, m_streamAlgorithmMap[algStreamName]));
+            if (m_streamAlgorithmMap.at(algStreamName).empty())
+            {
+                std::cout << "StreamingAlgorithm::ReadSettings - Error: Found no algorithms for \'" << algStreamName << "\'" << std::endl;
+                return STATUS_CODE_NOT_FOUND;
+            }
         }
     }
 
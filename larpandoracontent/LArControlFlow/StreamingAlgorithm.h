@@ -10,6 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArControlFlow/StreamClusterRegistry.h"
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+
 namespace lar_content
 {
 
@@ -28,14 +31,86 @@ public:
 
 private:
     typedef std::map<std::string, pandora::StringVector> StreamAlgorithmMap;
+    typedef std::vector<const pandora::Pandora *> PandoraInstanceVector;
     pandora::StatusCode Run();
+    pandora::StatusCode Reset();
+
+    /**
+     *  @brief  Initialize the worker instances, one per input list, used when running the streams concurrently
+     */
+    pandora::StatusCode InitializeWorkerInstances();
+
+    /**
+     *  @brief  Run the algorithms for each stream in turn, within this pandora instance
+     */
+    pandora::StatusCode RunStreamsSerially();
+
+    /**
+     *  @brief  Run the streams concurrently, each within its own worker instance, then collect the output clusters in stream order
+     */
+    pandora::StatusCode RunStreamsConcurrently();
+
+    /**
+     *  @brief  Get the input for a stream: all hits in the input list and, for cluster lists, the hit groupings of the input clusters
+     *
+     *  @param  inputListName the name of the input list
+     *  @param  caloHitList to receive the hits to be copied into the worker instance
+     *  @param  inputClusters to receive the hit groupings of the input clusters
+     */
+    pandora::StatusCode GetStreamInput(
+        const std::string &inputListName, pandora::CaloHitList &caloHitList, StreamClusterRegistry::ClusterHitsVector &inputClusters) const;
+
+    /**
+     *  @brief  Copy the input hits into a worker instance, registering the input cluster hit groupings for the worker
+     *
+     *  @param  caloHitList the hits to copy into the worker instance
+     *  @param  inputClusters the hit groupings of the input clusters
+     *  @param  pWorkerPandora address of the worker pandora instance
+     */
+    pandora::StatusCode CopyToWorkerInstance(const pandora::CaloHitList &caloHitList,
+        const StreamClusterRegistry::ClusterHitsVector &inputClusters, const pandora::Pandora *const pWorkerPandora) const;
+
+    /**
+     *  @brief  Create the output clusters of a worker instance, replacing any input clusters, then save the output list
+     *
+     *  @param  inputListName the name of the input cluster list
+     *  @param  outputListName the name of the output cluster list
+     *  @param  pWorkerPandora address of the worker pandora instance
+     */
+    pandora::StatusCode CollectFromWorkerInstance(
+        const std::string &inputListName, const std::string &outputListName, const pandora::Pandora *const pWorkerPandora) const;
+
+    /**
+     *  @brief  Create a worker instance, with geometry matching this pandora instance, configured using a given settings file. The worker
+     *          is registered as a daughter of the primary pandora instance, which must be known to the multi pandora api.
+     *
+     *  @param  settingsFile the pandora settings file
+     *  @param  name the name of the worker instance
+     *
+     *  @return the address of the worker pandora instance
+     */
+    const pandora::Pandora *CreateWorkerInstance(const std::string &settingsFile, const std::string &name) const;
+
+    /**
+     *  @brief  Register custom content, such as algorithms or algorithm tools, with a specified pandora instance
+     *
+     *  @param  pPandora the address of the pandora instance
+     */
+    virtual pandora::StatusCode RegisterCustomContent(const pandora::Pandora *const pPandora) const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     std::string m_outputListName;            ///< The name of the output list
-    std::string m_listType;                  ///< The type of the input lists (currently only Cluster is supported)
+    std::string m_listType;                  ///< The type of the input lists (Cluster or CaloHit)
     pandora::StringVector m_inputListNames;  ///< The names of the input lists
     pandora::StringVector m_outputListNames; ///< Names of the output lists if not combining into a single list at the end
     StreamAlgorithmMap m_streamAlgorithmMap; ///< A map from individual streams to the algorithms that stream should run
+
+    bool m_runStreamsConcurrently;               ///< Whether to run the streams concurrently, each within its own worker instance
+    pandora::StringVector m_streamSettingsFiles; ///< The worker instance settings files, one per input list, if running concurrently
+    std::string m_filePathEnvironmentVariable;   ///< The environment variable providing a list of paths to xml files
+    PandoraInstanceVector m_workerInstances;     ///< The worker instances, one per input list, created on first use
+    LArCaloHitFactory m_larCaloHitFactory;       ///< Factory for creating LArCaloHits during hit copying
 };
 
 } // namespace lar_content
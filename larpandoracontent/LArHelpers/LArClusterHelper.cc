@@ -64,31 +64,16 @@ void LArClusterHelper::GetClustersByHitType(const ClusterList &inputClusters, co
 
 float LArClusterHelper::GetLengthSquared(const Cluster *const pCluster)
 {
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
-
-    if (orderedCaloHitList.empty())
+    if (pCluster->GetOrderedCaloHitList().empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
     // ATTN In 2D case, we will actually calculate the quadrature sum of deltaX and deltaU/V/W
-    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
-    float minY(std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max());
-    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
-
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
-    {
-        for (CaloHitList::const_iterator hitIter = iter->second->begin(), hitIterEnd = iter->second->end(); hitIter != hitIterEnd; ++hitIter)
-        {
-            const CartesianVector &hitPosition((*hitIter)->GetPositionVector());
-            minX = std::min(hitPosition.GetX(), minX);
-            maxX = std::max(hitPosition.GetX(), maxX);
-            minY = std::min(hitPosition.GetY(), minY);
-            maxY = std::max(hitPosition.GetY(), maxY);
-            minZ = std::min(hitPosition.GetZ(), minZ);
-            maxZ = std::max(hitPosition.GetZ(), maxZ);
-        }
-    }
+    CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+    LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
 
-    const float deltaX(maxX - minX), deltaY(maxY - minY), deltaZ(maxZ - minZ);
+    const float deltaX(maximumCoordinate.GetX() - minimumCoordinate.GetX());
+    const float deltaY(maximumCoordinate.GetY() - minimumCoordinate.GetY());
+    const float deltaZ(maximumCoordinate.GetZ() - minimumCoordinate.GetZ());
     return (deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
 }
 
@@ -330,6 +315,25 @@ void LArClusterHelper::GetClosestPositions(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArClusterHelper::GetClusterBoundingBox(const Cluster *const pCluster, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate)
+{
+    ClusterAttributes *const pClusterAttributes(LArClusterHelper::GetClusterAttributes(pCluster));
+
+    if (!pClusterAttributes)
+        return LArClusterHelper::CalculateClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
+
+    if (!pClusterAttributes->m_hasBoundingBox)
+    {
+        LArClusterHelper::CalculateClusterBoundingBox(pCluster, pClusterAttributes->m_minimumCoordinate, pClusterAttributes->m_maximumCoordinate);
+        pClusterAttributes->m_hasBoundingBox = true;
+    }
+
+    minimumCoordinate = pClusterAttributes->m_minimumCoordinate;
+    maximumCoordinate = pClusterAttributes->m_maximumCoordinate;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::CalculateClusterBoundingBox(const Cluster *const pCluster, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate)
 {
     const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
 
@@ -414,7 +418,29 @@ void LArClusterHelper::GetExtremalCoordinates(const ClusterList &clusterList, Ca
 
 void LArClusterHelper::GetExtremalCoordinates(const Cluster *const pCluster, CartesianVector &innerCoordinate, CartesianVector &outerCoordinate)
 {
-    return LArClusterHelper::GetExtremalCoordinates(pCluster->GetOrderedCaloHitList(), innerCoordinate, outerCoordinate);
+    ClusterAttributes *const pClusterAttributes(LArClusterHelper::GetClusterAttributes(pCluster));
+
+    if (!pClusterAttributes)
+        return LArClusterHelper::GetExtremalCoordinates(pCluster->GetOrderedCaloHitList(), innerCoordinate, outerCoordinate);
+
+    if (!pClusterAttributes->m_hasExtremalCoordinates)
+    {
+        if (pCluster->GetOrderedCaloHitList().empty())
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+        if (!pClusterAttributes->m_hasCoordinateVector)
+        {
+            LArClusterHelper::CalculateCoordinateVector(pCluster, pClusterAttributes->m_coordinateVector);
+            pClusterAttributes->m_hasCoordinateVector = true;
+        }
+
+        LArClusterHelper::GetExtremalCoordinates(
+            pClusterAttributes->m_coordinateVector, pClusterAttributes->m_innerCoordinate, pClusterAttributes->m_outerCoordinate);
+        pClusterAttributes->m_hasExtremalCoordinates = true;
+    }
+
+    innerCoordinate = pClusterAttributes->m_innerCoordinate;
+    outerCoordinate = pClusterAttributes->m_outerCoordinate;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -547,6 +573,29 @@ void LArClusterHelper::GetExtremalCoordinates(const CartesianPointVector &coordi
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArClusterHelper::GetCoordinateVector(const Cluster *const pCluster, CartesianPointVector &coordinateVector)
+{
+    ClusterAttributes *const pClusterAttributes(LArClusterHelper::GetClusterAttributes(pCluster));
+
+    if (!pClusterAttributes)
+        return LArClusterHelper::CalculateCoordinateVector(pCluster, coordinateVector);
+
+    if (!pClusterAttributes->m_hasCoordinateVector)
+    {
+        LArClusterHelper::CalculateCoordinateVector(pCluster, pClusterAttributes->m_coordinateVector);
+        pClusterAttributes->m_hasCoordinateVector = true;
+    }
+
+    // ATTN Preserve behaviour for a non-empty input vector, with all coordinates sorted together
+    const bool wasEmpty(coordinateVector.empty());
+    coordinateVector.insert(coordinateVector.end(), pClusterAttributes->m_coordinateVector.begin(), pClusterAttributes->m_coordinateVector.end());
+
+    if (!wasEmpty)
+        std::sort(coordinateVector.begin(), coordinateVector.end(), LArClusterHelper::SortCoordinatesByPosition);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::CalculateCoordinateVector(const Cluster *const pCluster, CartesianPointVector &coordinateVector)
 {
     for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
     {
@@ -757,4 +806,60 @@ bool LArClusterHelper::SortCoordinatesByPosition(const CartesianVector &lhs, con
     return (deltaPosition.GetY() > std::numeric_limits<float>::epsilon());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterAttributes *LArClusterHelper::GetClusterAttributes(const Cluster *const pCluster)
+{
+    // ATTN Entries are only valid whilst a cluster attribute cache is in scope, as clusters cannot then be modified or deleted
+    if (0 == m_clusterAttributeCacheDepth)
+        return nullptr;
+
+    ClusterAttributesMap::iterator iter(m_clusterAttributesMap.find(pCluster));
+
+    if (m_clusterAttributesMap.end() != iter)
+        return &(iter->second);
+
+    if (m_clusterAttributesMap.size() >= m_maxClusterAttributesMapSize)
+        m_clusterAttributesMap.clear();
+
+    return &(m_clusterAttributesMap.emplace(pCluster, ClusterAttributes()).first->second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+thread_local unsigned int LArClusterHelper::m_clusterAttributeCacheDepth(0);
+thread_local LArClusterHelper::ClusterAttributesMap LArClusterHelper::m_clusterAttributesMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterAttributeCache::ClusterAttributeCache(const bool isEnabled) :
+    m_isEnabled(isEnabled)
+{
+    if (m_isEnabled)
+        ++m_clusterAttributeCacheDepth;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterAttributeCache::~ClusterAttributeCache()
+{
+    if (m_isEnabled && (0 == --m_clusterAttributeCacheDepth))
+        m_clusterAttributesMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterAttributes::ClusterAttributes() :
+    m_hasCoordinateVector(false),
+    m_hasExtremalCoordinates(false),
+    m_innerCoordinate(0.f, 0.f, 0.f),
+    m_outerCoordinate(0.f, 0.f, 0.f),
+    m_hasBoundingBox(false),
+    m_minimumCoordinate(0.f, 0.f, 0.f),
+    m_maximumCoordinate(0.f, 0.f, 0.f)
+{
+}
+
 } // namespace lar_content
@@ -10,6 +10,8 @@
 
 #include "Objects/Cluster.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -21,6 +23,31 @@ class LArClusterHelper
 public:
     typedef std::set<unsigned int> UIntSet;
 
+    /**
+     *  @brief  ClusterAttributeCache class. Whilst an instance is in scope, derived cluster quantities (sorted coordinate vectors, extremal
+     *          coordinates and bounding boxes) are cached for the current thread, keyed by cluster address. The cache is cleared when the
+     *          outermost instance goes out of scope. The owner must ensure that no cluster is modified or deleted, and that no other
+     *          pandora instance runs on the thread, whilst an instance is in scope.
+     */
+    class ClusterAttributeCache
+    {
+    public:
+        /**
+         *  @brief  Constructor, enabling the cache for the current thread
+         *
+         *  @param  isEnabled whether to enable the cache, allowing callers to make its use configurable
+         */
+        ClusterAttributeCache(const bool isEnabled = true);
+
+        /**
+         *  @brief  Destructor, disabling and clearing the cache for the current thread if this is the outermost enabled instance
+         */
+        ~ClusterAttributeCache();
+
+    private:
+        const bool m_isEnabled; ///< Whether this instance enabled the cache
+    };
+
     /**
      *  @brief  Get the hit type associated with a two dimensional cluster
      *
@@ -374,6 +401,61 @@ public:
      *  @param  rhs second point
      */
     static bool SortCoordinatesByPosition(const pandora::CartesianVector &lhs, const pandora::CartesianVector &rhs);
+
+private:
+    /**
+     *  @brief  ClusterAttributes class, holding derived quantities for a single cluster, calculated on first request
+     */
+    class ClusterAttributes
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ClusterAttributes();
+
+        bool m_hasCoordinateVector;                       ///< Whether the sorted coordinate vector has been calculated
+        pandora::CartesianPointVector m_coordinateVector; ///< The hit coordinates, sorted by position
+        bool m_hasExtremalCoordinates;                    ///< Whether the extremal coordinates have been calculated
+        pandora::CartesianVector m_innerCoordinate;       ///< The inner extremal coordinate
+        pandora::CartesianVector m_outerCoordinate;       ///< The outer extremal coordinate
+        bool m_hasBoundingBox;                            ///< Whether the bounding box has been calculated
+        pandora::CartesianVector m_minimumCoordinate;     ///< The minimum (x,y,z) bounding box coordinate
+        pandora::CartesianVector m_maximumCoordinate;     ///< The maximum (x,y,z) bounding box coordinate
+    };
+
+    typedef std::unordered_map<const pandora::Cluster *, ClusterAttributes> ClusterAttributesMap;
+
+    /**
+     *  @brief  Get the cached attributes for a cluster
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return address of the cluster attributes, or nullptr if no cluster attribute cache is in scope on the current thread
+     */
+    static ClusterAttributes *GetClusterAttributes(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Calculate the minimum and maximum X, Y and Z positions of the calo hits in a cluster, without reference to the cache
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  the minimum positions (x,y,z)
+     *  @param  the maximum positions (x,y,z)
+     */
+    static void CalculateClusterBoundingBox(
+        const pandora::Cluster *const pCluster, pandora::CartesianVector &minimumCoordinate, pandora::CartesianVector &maximumCoordinate);
+
+    /**
+     *  @brief  Calculate the sorted vector of hit coordinates from an input cluster, without reference to the cache
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  coordinateVector to receive the sorted coordinates
+     */
+    static void CalculateCoordinateVector(const pandora::Cluster *const pCluster, pandora::CartesianPointVector &coordinateVector);
+
+    static thread_local unsigned int m_clusterAttributeCacheDepth;    ///< The number of cluster attribute caches in scope on this thread
+    static thread_local ClusterAttributesMap m_clusterAttributesMap;  ///< The per-thread cache of derived cluster quantities
+    static const unsigned int m_maxClusterAttributesMapSize = 100000; ///< The cache size above which the cache is flushed
 };
 
 } // namespace lar_content
@@ -6,6 +6,8 @@
  *  $Log: $
  */
 
+#include "Api/PandoraApi.h"
+
 #include "Managers/GeometryManager.h"
 #include "Managers/PluginManager.h"
 
@@ -570,4 +572,56 @@ float LArGeometryHelper::GetSigmaUVW(const Pandora &pandora, const float maxSigm
     return sigmaUVW;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::CopyLArTPC(const Pandora &pandora, const LArTPC &larTPC)
+{
+    PandoraApi::Geometry::LArTPC::Parameters larTPCParameters;
+    larTPCParameters.m_larTPCVolumeId = larTPC.GetLArTPCVolumeId();
+    larTPCParameters.m_centerX = larTPC.GetCenterX();
+    larTPCParameters.m_centerY = larTPC.GetCenterY();
+    larTPCParameters.m_centerZ = larTPC.GetCenterZ();
+    larTPCParameters.m_widthX = larTPC.GetWidthX();
+    larTPCParameters.m_widthY = larTPC.GetWidthY();
+    larTPCParameters.m_widthZ = larTPC.GetWidthZ();
+    larTPCParameters.m_wirePitchU = larTPC.GetWirePitchU();
+    larTPCParameters.m_wirePitchV = larTPC.GetWirePitchV();
+    larTPCParameters.m_wirePitchW = larTPC.GetWirePitchW();
+    larTPCParameters.m_wireAngleU = larTPC.GetWireAngleU();
+    larTPCParameters.m_wireAngleV = larTPC.GetWireAngleV();
+    larTPCParameters.m_wireAngleW = larTPC.GetWireAngleW();
+    larTPCParameters.m_sigmaUVW = larTPC.GetSigmaUVW();
+    larTPCParameters.m_isDriftInPositiveX = larTPC.IsDriftInPositiveX();
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LArTPC::Create(pandora, larTPCParameters));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::CopyLineGap(const Pandora &pandora, const LineGap &lineGap, const bool spanAllX)
+{
+    PandoraApi::Geometry::LineGap::Parameters lineGapParameters;
+    lineGapParameters.m_lineGapType = lineGap.GetLineGapType();
+    lineGapParameters.m_lineStartX = spanAllX ? -std::numeric_limits<float>::max() : lineGap.GetLineStartX();
+    lineGapParameters.m_lineEndX = spanAllX ? std::numeric_limits<float>::max() : lineGap.GetLineEndX();
+    lineGapParameters.m_lineStartZ = lineGap.GetLineStartZ();
+    lineGapParameters.m_lineEndZ = lineGap.GetLineEndZ();
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LineGap::Create(pandora, lineGapParameters));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::CopyGeometry(const Pandora &inputPandora, const Pandora &outputPandora)
+{
+    for (const LArTPCMap::value_type &mapEntry : inputPandora.GetGeometry()->GetLArTPCMap())
+        LArGeometryHelper::CopyLArTPC(outputPandora, *(mapEntry.second));
+
+    for (const DetectorGap *const pGap : inputPandora.GetGeometry()->GetDetectorGapList())
+    {
+        const LineGap *const pLineGap(dynamic_cast<const LineGap *>(pGap));
+
+        if (pLineGap)
+            LArGeometryHelper::CopyLineGap(outputPandora, *pLineGap);
+    }
+}
+
 } // namespace lar_content
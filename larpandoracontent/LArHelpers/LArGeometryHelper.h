@@ -17,6 +17,8 @@
 namespace pandora
 {
 class CartesianVector;
+class LArTPC;
+class LineGap;
 class Pandora;
 } // namespace pandora
 
@@ -267,6 +269,31 @@ public:
      *  @param  pCluster2 the second cluster
      */
     static void GetCommonDaughterVolumes(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, UIntSet &intersect);
+
+    /**
+     *  @brief  Create, within a pandora instance, a copy of a lar tpc
+     *
+     *  @param  pandora the pandora instance in which to create the lar tpc
+     *  @param  larTPC the lar tpc to copy
+     */
+    static void CopyLArTPC(const pandora::Pandora &pandora, const pandora::LArTPC &larTPC);
+
+    /**
+     *  @brief  Create, within a pandora instance, a copy of a line gap
+     *
+     *  @param  pandora the pandora instance in which to create the line gap
+     *  @param  lineGap the line gap to copy
+     *  @param  spanAllX whether the copy should instead extend across all x positions
+     */
+    static void CopyLineGap(const pandora::Pandora &pandora, const pandora::LineGap &lineGap, const bool spanAllX = false);
+
+    /**
+     *  @brief  Create, within a pandora instance, copies of all the lar tpcs and line gaps of another pandora instance
+     *
+     *  @param  inputPandora the pandora instance whose geometry is to be copied
+     *  @param  outputPandora the pandora instance in which to create the geometry
+     */
+    static void CopyGeometry(const pandora::Pandora &inputPandora, const pandora::Pandora &outputPandora);
 };
 //------------------------------------------------------------------------------------------------------------------------------------------
 
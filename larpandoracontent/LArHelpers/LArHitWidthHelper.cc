@@ -87,7 +87,9 @@ const LArHitWidthHelper::ClusterParameters &LArHitWidthHelper::GetClusterParamet
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-unsigned int LArHitWidthHelper::GetNProposedConstituentHits(const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor)
+template <typename TVISITOR>
+void LArHitWidthHelper::VisitConstituentHits(const Cluster *const pCluster, const float maxConstituentHitWidth,
+    const float hitWidthScalingFactor, const bool isUniform, TVISITOR &&visitor)
 {
     if (maxConstituentHitWidth < std::numeric_limits<float>::epsilon())
     {
@@ -100,25 +102,58 @@ unsigned int LArHitWidthHelper::GetNProposedConstituentHits(const Cluster *const
     if (orderedCaloHitList.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    unsigned int totalConstituentHits(0);
     for (const OrderedCaloHitList::value_type &mapEntry : orderedCaloHitList)
     {
         for (const CaloHit *const pCaloHit : *mapEntry.second)
         {
             const float hitWidth = pCaloHit->GetCellSize1() * hitWidthScalingFactor;
             const unsigned int numberOfConstituentHits = std::ceil(hitWidth / maxConstituentHitWidth);
+            const float constituentHitWidth(isUniform ? maxConstituentHitWidth : hitWidth / numberOfConstituentHits);
 
-            totalConstituentHits += numberOfConstituentHits;
+            visitor(pCaloHit, numberOfConstituentHits, constituentHitWidth);
         }
     }
+}
 
-    return totalConstituentHits;
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+void LArHitWidthHelper::SplitHitIntoConstituentPositions(
+    const CaloHit *const pCaloHit, const unsigned int numberOfConstituentHits, const float constituentHitWidth, TFUNCTION &&addPosition)
+{
+    const CartesianVector &hitCenter(pCaloHit->GetPositionVector());
+    const bool isOdd(numberOfConstituentHits % 2 == 1);
+    float xDistanceFromCenter(0.f);
+
+    // find constituent hit centers by moving out from the original hit center position
+    unsigned int loopIterations(std::ceil(numberOfConstituentHits / 2.0));
+    for (unsigned int i = 0; i < loopIterations; ++i)
+    {
+        if (i == 0)
+        {
+            if (isOdd)
+            {
+                addPosition(hitCenter);
+                continue;
+            }
+            else
+            {
+                xDistanceFromCenter += constituentHitWidth / 2;
+            }
+        }
+        else
+        {
+            xDistanceFromCenter += constituentHitWidth;
+        }
+
+        addPosition(hitCenter + CartesianVector(xDistanceFromCenter, 0.f, 0.f));
+        addPosition(hitCenter - CartesianVector(xDistanceFromCenter, 0.f, 0.f));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
-    const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform)
+unsigned int LArHitWidthHelper::GetNProposedConstituentHits(const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor)
 {
     if (maxConstituentHitWidth < std::numeric_limits<float>::epsilon())
     {
@@ -131,64 +166,68 @@ LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
     if (orderedCaloHitList.empty())
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    ConstituentHitVector constituentHitVector;
+    unsigned int totalConstituentHits(0);
     for (const OrderedCaloHitList::value_type &mapEntry : orderedCaloHitList)
     {
         for (const CaloHit *const pCaloHit : *mapEntry.second)
         {
             const float hitWidth = pCaloHit->GetCellSize1() * hitWidthScalingFactor;
             const unsigned int numberOfConstituentHits = std::ceil(hitWidth / maxConstituentHitWidth);
-            if (isUniform)
-            {
-                LArHitWidthHelper::SplitHitIntoConstituents(pCaloHit, pCluster, numberOfConstituentHits, maxConstituentHitWidth, constituentHitVector);
-            }
-            else
-            {
-                const float constituentHitWidth = hitWidth / numberOfConstituentHits;
-                LArHitWidthHelper::SplitHitIntoConstituents(pCaloHit, pCluster, numberOfConstituentHits, constituentHitWidth, constituentHitVector);
-            }
+
+            totalConstituentHits += numberOfConstituentHits;
         }
     }
 
+    return totalConstituentHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
+    const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform)
+{
+    ConstituentHitVector constituentHitVector;
+    LArHitWidthHelper::GetConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform, constituentHitVector);
+
     return constituentHitVector;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArHitWidthHelper::SplitHitIntoConstituents(const CaloHit *const pCaloHit, const Cluster *const pCluster,
-    const unsigned int numberOfConstituentHits, const float constituentHitWidth, LArHitWidthHelper::ConstituentHitVector &constituentHitVector)
+void LArHitWidthHelper::GetConstituentHits(const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor,
+    const bool isUniform, ConstituentHitVector &constituentHitVector)
 {
-    const CartesianVector &hitCenter(pCaloHit->GetPositionVector());
-    const bool isOdd(numberOfConstituentHits % 2 == 1);
-    float xDistanceFromCenter(0.f);
+    constituentHitVector.reserve(
+        constituentHitVector.size() + LArHitWidthHelper::GetNProposedConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor));
 
-    // find constituent hit centers by moving out from the original hit center position
-    unsigned int loopIterations(std::ceil(numberOfConstituentHits / 2.0));
-    for (unsigned int i = 0; i < loopIterations; ++i)
-    {
-        if (i == 0)
-        {
-            if (isOdd)
-            {
-                constituentHitVector.push_back(ConstituentHit(hitCenter, constituentHitWidth, pCluster));
-                continue;
-            }
-            else
-            {
-                xDistanceFromCenter += constituentHitWidth / 2;
-            }
-        }
-        else
-        {
-            xDistanceFromCenter += constituentHitWidth;
-        }
+    LArHitWidthHelper::VisitConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform,
+        [&](const CaloHit *const pCaloHit, const unsigned int numberOfConstituentHits, const float constituentHitWidth) {
+            LArHitWidthHelper::SplitHitIntoConstituents(pCaloHit, pCluster, numberOfConstituentHits, constituentHitWidth, constituentHitVector);
+        });
+}
 
-        CartesianVector positivePosition(hitCenter + CartesianVector(xDistanceFromCenter, 0.f, 0.f)),
-            negativePosition(hitCenter - CartesianVector(xDistanceFromCenter, 0.f, 0.f));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        constituentHitVector.push_back(ConstituentHit(positivePosition, constituentHitWidth, pCluster));
-        constituentHitVector.push_back(ConstituentHit(negativePosition, constituentHitWidth, pCluster));
-    }
+void LArHitWidthHelper::GetConstituentHitPositions(const Cluster *const pCluster, const float maxConstituentHitWidth,
+    const float hitWidthScalingFactor, const bool isUniform, CartesianPointVector &constituentHitPositionVector)
+{
+    constituentHitPositionVector.reserve(
+        constituentHitPositionVector.size() + LArHitWidthHelper::GetNProposedConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor));
+
+    LArHitWidthHelper::VisitConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform,
+        [&](const CaloHit *const pCaloHit, const unsigned int numberOfConstituentHits, const float constituentHitWidth) {
+            LArHitWidthHelper::SplitHitIntoConstituentPositions(pCaloHit, numberOfConstituentHits, constituentHitWidth,
+                [&](const CartesianVector &position) { constituentHitPositionVector.push_back(position); });
+        });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthHelper::SplitHitIntoConstituents(const CaloHit *const pCaloHit, const Cluster *const pCluster,
+    const unsigned int numberOfConstituentHits, const float constituentHitWidth, LArHitWidthHelper::ConstituentHitVector &constituentHitVector)
+{
+    LArHitWidthHelper::SplitHitIntoConstituentPositions(pCaloHit, numberOfConstituentHits, constituentHitWidth,
+        [&](const CartesianVector &position) { constituentHitVector.push_back(ConstituentHit(position, constituentHitWidth, pCluster)); });
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -223,11 +262,20 @@ float LArHitWidthHelper::GetOriginalTotalClusterWeight(const Cluster *const pClu
 CartesianPointVector LArHitWidthHelper::GetConstituentHitPositionVector(const ConstituentHitVector &constituentHitVector)
 {
     CartesianPointVector constituentHitPositionVector;
+    LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector, constituentHitPositionVector);
+
+    return constituentHitPositionVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthHelper::GetConstituentHitPositionVector(
+    const ConstituentHitVector &constituentHitVector, CartesianPointVector &constituentHitPositionVector)
+{
+    constituentHitPositionVector.reserve(constituentHitPositionVector.size() + constituentHitVector.size());
 
     for (const ConstituentHit &constituentHit : constituentHitVector)
         constituentHitPositionVector.push_back(constituentHit.GetPositionVector());
-
-    return constituentHitPositionVector;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -256,7 +304,14 @@ void LArHitWidthHelper::GetExtremalCoordinatesX(
     const ConstituentHitVector &constituentHitVector, CartesianVector &lowerXCoordinate, CartesianVector &higherXCoordinate)
 {
     const CartesianPointVector &constituentHitPositionVector(GetConstituentHitPositionVector(constituentHitVector));
+    LArHitWidthHelper::GetExtremalCoordinatesX(constituentHitPositionVector, lowerXCoordinate, higherXCoordinate);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArHitWidthHelper::GetExtremalCoordinatesX(
+    const CartesianPointVector &constituentHitPositionVector, CartesianVector &lowerXCoordinate, CartesianVector &higherXCoordinate)
+{
     CartesianVector innerCoordinate(0.f, 0.f, 0.f), outerCoordinate(0.f, 0.f, 0.f);
     LArClusterHelper::GetExtremalCoordinates(constituentHitPositionVector, innerCoordinate, outerCoordinate);
 
@@ -222,6 +222,32 @@ public:
     static ConstituentHitVector GetConstituentHits(
         const pandora::Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor, const bool isUniform);
 
+    /**
+     *  @brief  Break up the cluster hits into constituent hits, writing into a caller-provided vector so that its storage may be reused
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *          in the non-uniform case constituent hits from different hits may have different weights
+     *  @param  constituentHitVector the input vector to which to add the constituent hits
+     */
+    static void GetConstituentHits(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor,
+        const bool isUniform, ConstituentHitVector &constituentHitVector);
+
+    /**
+     *  @brief  Break up the cluster hits into constituent hits and collect only their central positions, without creating any
+     *          intermediate constituent hit objects
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *  @param  constituentHitPositionVector the input vector to which to add the constituent hit central positions
+     */
+    static void GetConstituentHitPositions(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+        const float hitWidthScalingFactor, const bool isUniform, pandora::CartesianPointVector &constituentHitPositionVector);
+
     /**
      *  @brief  Break up the calo hit into constituent hits
      *
@@ -244,6 +270,15 @@ public:
      */
     static pandora::CartesianPointVector GetConstituentHitPositionVector(const ConstituentHitVector &constituentHitVector);
 
+    /**
+     *  @brief  Obtain a vector of the contituent hit central positions, writing into a caller-provided vector
+     *
+     *  @param  constituentHitVector the input vector of contituent hits
+     *  @param  constituentHitPositionVector the input vector to which to add the constituent hit central positions
+     */
+    static void GetConstituentHitPositionVector(
+        const ConstituentHitVector &constituentHitVector, pandora::CartesianPointVector &constituentHitPositionVector);
+
     /**
      *  @brief  Sum the widths of constituent hits
      *
@@ -290,6 +325,16 @@ public:
     static void GetExtremalCoordinatesX(const ConstituentHitVector &constituentHitVector, pandora::CartesianVector &lowerXCoordinate,
         pandora::CartesianVector &higherXCoordinate);
 
+    /**
+     *  @brief  Calculate the higher and lower x extremal points of a set of constituent hit positions
+     *
+     *  @param  constituentHitPositionVector the input vector of contituent hit central positions
+     *  @param  lowerXCoordinate the lower x extremal point
+     *  @param  higherXCoordinate the higher x extremal point
+     */
+    static void GetExtremalCoordinatesX(const pandora::CartesianPointVector &constituentHitPositionVector,
+        pandora::CartesianVector &lowerXCoordinate, pandora::CartesianVector &higherXCoordinate);
+
     /**
      *  @brief  Consider the hit width to find the closest position of a calo hit to a specified line
      *
@@ -311,6 +356,32 @@ public:
      *  @return  the smallest distance
      */
     static float GetClosestDistanceToPoint2D(const pandora::CaloHit *const pCaloHit, const pandora::CartesianVector &point2D);
+
+private:
+    /**
+     *  @brief  Visit each of the hits in a cluster, providing the number and width of the constituent hits into which it is broken
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *  @param  visitor the callable, receiving the calo hit, the number of constituent hits and the constituent hit width
+     */
+    template <typename TVISITOR>
+    static void VisitConstituentHits(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor,
+        const bool isUniform, TVISITOR &&visitor);
+
+    /**
+     *  @brief  Calculate the central positions of the constituent hits into which a calo hit is broken
+     *
+     *  @param  pCaloHit the input calo hit
+     *  @param  numberOfConstituentHits the number of constituent hits the hit will be broken into
+     *  @param  constituentHitWidth the hit width of the constituent hits
+     *  @param  addPosition the callable, receiving each constituent hit central position in turn
+     */
+    template <typename TFUNCTION>
+    static void SplitHitIntoConstituentPositions(const pandora::CaloHit *const pCaloHit, const unsigned int numberOfConstituentHits,
+        const float constituentHitWidth, TFUNCTION &&addPosition);
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
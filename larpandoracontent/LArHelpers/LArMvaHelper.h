@@ -19,6 +19,7 @@
 #include "Pandora/PandoraInternal.h"
 #include "Pandora/StatusCodes.h"
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <fstream>
@@ -48,13 +49,24 @@ public:
      *  @param  args arguments to pass to the tool
      */
     virtual void Run(MvaTypes::MvaFeatureVector &featureVector, Ts... args) = 0;
-    virtual void Run(MvaTypes::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName, Ts...)
-    {
-        (void)featureMap;
-        (void)featureOrder;
-        (void)featureToolName;
-        return;
-    };
+
+    /**
+     *  @brief  Run the algorithm tool, writing the features into a map keyed by feature name
+     *
+     *  @param  featureMap the map of features to append
+     *  @param  featureOrder the vector of feature names to append, recording the order in which features are written
+     *  @param  featureToolName the name of the feature tool instance
+     *  @param  args arguments to pass to the tool
+     */
+    virtual void Run(MvaTypes::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName, Ts... args);
+
+    /**
+     *  @brief  Get the names of the features calculated by the tool, in the order in which they are appended to a feature vector
+     *
+     *  @param  featureToolName the name of the feature tool instance
+     *  @param  featureNames to receive the feature names
+     */
+    virtual void GetFeatureNames(const std::string &featureToolName, pandora::StringVector &featureNames) const;
 };
 
 template <typename... Ts>
@@ -184,6 +196,19 @@ public:
     static MvaFeatureMap CalculateFeatures(const pandora::StringVector &featureToolOrder, const MvaFeatureToolMap<Ts...> &featureToolMap,
         pandora::StringVector &featureOrder, TARGS &&... args);
 
+    /**
+     *  @brief  Calculate the features in a given feature tool vector, writing them into a caller-provided feature vector whose
+     *          indices correspond to the feature ids registered via RegisterFeatures
+     *
+     *  @param  featureToolVector the feature tool vector, as registered
+     *  @param  featureOrder the registered feature names, indexed by feature id
+     *  @param  featureVector the feature vector to fill, cleared on entry so that its capacity may be reused between calls
+     *  @param  args arguments to pass to the tool
+     */
+    template <typename... Ts, typename... TARGS>
+    static void FillFeatures(const MvaFeatureToolVector<Ts...> &featureToolVector, const pandora::StringVector &featureOrder,
+        MvaFeatureVector &featureVector, TARGS &&... args);
+
     /**
      *  @brief  Calculate the features of a given derived feature tool type in a feature tool vector
      *
@@ -219,6 +244,21 @@ public:
     static pandora::StatusCode AddFeatureToolToMap(
         pandora::AlgorithmTool *const pFeatureTool, std::string pFeatureToolName, MvaFeatureToolMap<Ts...> &featureToolMap);
 
+    /**
+     *  @brief  Register the features provided by an ordered list of named feature tools, assigning each feature a dense id. The
+     *          string-keyed configuration is resolved once, so that features can subsequently be calculated via FillFeatures
+     *
+     *  @param  featureToolOrder vector of strings of the ordered keys
+     *  @param  featureToolMap the feature tool map
+     *  @param  featureToolVector to receive the feature tools, in the requested order
+     *  @param  featureOrder to receive the feature names, indexed by feature id
+     *
+     *  @return success
+     */
+    template <typename... Ts>
+    static pandora::StatusCode RegisterFeatures(const pandora::StringVector &featureToolOrder, const MvaFeatureToolMap<Ts...> &featureToolMap,
+        MvaFeatureToolVector<Ts...> &featureToolVector, pandora::StringVector &featureOrder);
+
     /**
      *  @brief  Process a list of algorithms tools in an xml file, using a map. Idea is for this to go to XmlHelper in PandoraSDK eventually as an overload to ProcessAlgorithmToolList
      *
@@ -281,6 +321,52 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename... Ts>
+void MvaFeatureTool<Ts...>::Run(MvaTypes::MvaFeatureMap &featureMap, pandora::StringVector &featureOrder, const std::string &featureToolName, Ts... args)
+{
+    pandora::StringVector featureNames;
+    this->GetFeatureNames(featureToolName, featureNames);
+
+    if (featureNames.empty())
+        return;
+
+    MvaTypes::MvaFeatureVector toolFeatureVec;
+    this->Run(toolFeatureVec, args...);
+
+    if (toolFeatureVec.size() != featureNames.size())
+    {
+        std::cout << "MvaFeatureTool: feature tool " << featureToolName << " calculated an unexpected number of features." << std::endl;
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+    }
+
+    for (const std::string &featureName : featureNames)
+    {
+        if (featureMap.find(featureName) != featureMap.end())
+        {
+            std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+        }
+    }
+
+    for (size_t iFeature = 0; iFeature < featureNames.size(); ++iFeature)
+    {
+        featureOrder.push_back(featureNames.at(iFeature));
+        featureMap[featureNames.at(iFeature)] = toolFeatureVec.at(iFeature).Get();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename... Ts>
+void MvaFeatureTool<Ts...>::GetFeatureNames(const std::string &featureToolName, pandora::StringVector &featureNames) const
+{
+    (void)featureToolName;
+    (void)featureNames;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename TCONTAINER>
 pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TCONTAINER &&featureContainer)
 {
@@ -430,6 +516,26 @@ LArMvaHelper::MvaFeatureMap LArMvaHelper::CalculateFeatures(const pandora::Strin
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename... Ts, typename... TARGS>
+void LArMvaHelper::FillFeatures(const MvaFeatureToolVector<Ts...> &featureToolVector, const pandora::StringVector &featureOrder,
+    MvaFeatureVector &featureVector, TARGS &&... args)
+{
+    featureVector.clear();
+    featureVector.reserve(featureOrder.size());
+
+    for (MvaFeatureTool<Ts...> *const pFeatureTool : featureToolVector)
+        pFeatureTool->Run(featureVector, std::forward<TARGS>(args)...);
+
+    if (featureVector.size() != featureOrder.size())
+    {
+        std::cout << "LArMvaHelper::FillFeatures "
+                  << "- Error: calculated " << featureVector.size() << " features, but " << featureOrder.size() << " were registered." << std::endl;
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T, typename... Ts, typename... TARGS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeaturesOfType(const MvaFeatureToolVector<Ts...> &featureToolVector, TARGS &&... args)
 {
@@ -476,6 +582,47 @@ pandora::StatusCode LArMvaHelper::AddFeatureToolToMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename... Ts>
+pandora::StatusCode LArMvaHelper::RegisterFeatures(const pandora::StringVector &featureToolOrder, const MvaFeatureToolMap<Ts...> &featureToolMap,
+    MvaFeatureToolVector<Ts...> &featureToolVector, pandora::StringVector &featureOrder)
+{
+    featureToolVector.clear();
+    featureOrder.clear();
+
+    for (const std::string &featureToolName : featureToolOrder)
+    {
+        const auto iter(featureToolMap.find(featureToolName));
+
+        if (featureToolMap.end() == iter)
+        {
+            std::cout << "LArMvaHelper::RegisterFeatures "
+                      << "- Error: feature tool " << featureToolName << " not found." << std::endl;
+            return pandora::STATUS_CODE_NOT_FOUND;
+        }
+
+        pandora::StringVector featureNames;
+        iter->second->GetFeatureNames(featureToolName, featureNames);
+
+        for (const std::string &featureName : featureNames)
+        {
+            if (featureOrder.end() != std::find(featureOrder.begin(), featureOrder.end(), featureName))
+            {
+                std::cout << "LArMvaHelper::RegisterFeatures "
+                          << "- Error: feature " << featureName << " registered more than once." << std::endl;
+                return pandora::STATUS_CODE_ALREADY_PRESENT;
+            }
+
+            featureOrder.push_back(featureName);
+        }
+
+        featureToolVector.push_back(iter->second);
+    }
+
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline std::string LArMvaHelper::GetTimestampString()
 {
     std::time_t timestampNow = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
@@ -22,7 +22,7 @@ namespace lar_content
 
 const LArTPC &LArStitchingHelper::FindClosestTPC(const Pandora &pandora, const LArTPC &inputTPC, const bool checkPositive)
 {
-    if (!MultiPandoraApi::GetPandoraInstanceMap().count(&pandora))
+    if (!MultiPandoraApi::IsPrimaryPandoraInstance(&pandora))
     {
         std::cout << "LArStitchingHelper::FindClosestTPC - functionality only available to primary/master Pandora instance " << std::endl;
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
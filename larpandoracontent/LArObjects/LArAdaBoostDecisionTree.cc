@@ -15,15 +15,19 @@ using namespace pandora;
 namespace lar_content
 {
 
+std::mutex AdaBoostDecisionTree::m_modelRegistryMutex;
+AdaBoostDecisionTree::ModelRegistry AdaBoostDecisionTree::m_modelRegistry;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 AdaBoostDecisionTree::AdaBoostDecisionTree() : m_pStrongClassifier(nullptr)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs)
+AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs) : m_pStrongClassifier(rhs.m_pStrongClassifier)
 {
-    m_pStrongClassifier = new StrongClassifier(*(rhs.m_pStrongClassifier));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -31,7 +35,7 @@ AdaBoostDecisionTree::AdaBoostDecisionTree(const AdaBoostDecisionTree &rhs)
 AdaBoostDecisionTree &AdaBoostDecisionTree::operator=(const AdaBoostDecisionTree &rhs)
 {
     if (this != &rhs)
-        m_pStrongClassifier = new StrongClassifier(*(rhs.m_pStrongClassifier));
+        m_pStrongClassifier = rhs.m_pStrongClassifier;
 
     return *this;
 }
@@ -40,7 +44,6 @@ AdaBoostDecisionTree &AdaBoostDecisionTree::operator=(const AdaBoostDecisionTree
 
 AdaBoostDecisionTree::~AdaBoostDecisionTree()
 {
-    delete m_pStrongClassifier;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -53,64 +56,19 @@ StatusCode AdaBoostDecisionTree::Initialize(const std::string &bdtXmlFileName, c
         return STATUS_CODE_ALREADY_INITIALIZED;
     }
 
-    TiXmlDocument xmlDocument(bdtXmlFileName);
-
-    if (!xmlDocument.LoadFile())
-    {
-        std::cout << "AdaBoostDecisionTree::Initialize - Invalid xml file." << std::endl;
-        return STATUS_CODE_INVALID_PARAMETER;
-    }
-
-    const TiXmlHandle xmlDocumentHandle(&xmlDocument);
-    TiXmlNode *pContainerXmlNode(TiXmlHandle(xmlDocumentHandle).FirstChildElement().Element());
-
-    while (pContainerXmlNode)
-    {
-        if (pContainerXmlNode->ValueStr() != "AdaBoostDecisionTree")
-            return STATUS_CODE_FAILURE;
-
-        const TiXmlHandle currentHandle(pContainerXmlNode);
-
-        std::string currentName;
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(currentHandle, "Name", currentName));
-
-        if (currentName.empty() || (currentName.size() > 1000))
-        {
-            std::cout << "AdaBoostDecisionTree::Initialize - Implausible AdaBoostDecisionTree name extracted from xml." << std::endl;
-            return STATUS_CODE_INVALID_PARAMETER;
-        }
-
-        if (currentName == bdtName)
-            break;
-
-        pContainerXmlNode = pContainerXmlNode->NextSibling();
-    }
-
-    if (!pContainerXmlNode)
-    {
-        std::cout << "AdaBoostDecisionTree: Could not find an AdaBoostDecisionTree of name " << bdtName << std::endl;
-        return STATUS_CODE_NOT_FOUND;
-    }
+    // ATTN Lock held whilst reading, so that concurrently configured instances requesting the same model read it only once
+    const std::lock_guard<std::mutex> lock(m_modelRegistryMutex);
+    std::weak_ptr<const StrongClassifier> &pRegisteredStrongClassifier(m_modelRegistry[ModelKey(bdtXmlFileName, bdtName)]);
+    std::shared_ptr<const StrongClassifier> pStrongClassifier(pRegisteredStrongClassifier.lock());
 
-    const TiXmlHandle xmlHandle(pContainerXmlNode);
-
-    try
+    if (!pStrongClassifier)
     {
-        m_pStrongClassifier = new StrongClassifier(&xmlHandle);
-    }
-    catch (StatusCodeException &statusCodeException)
-    {
-        delete m_pStrongClassifier;
-
-        if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
-            std::cout << "AdaBoostDecisionTree: Initialization failure, unknown component in xml file." << std::endl;
-
-        if (STATUS_CODE_FAILURE == statusCodeException.GetStatusCode())
-            std::cout << "AdaBoostDecisionTree: Node definition does not contain expected leaf or branch variables." << std::endl;
-
-        return statusCodeException.GetStatusCode();
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, AdaBoostDecisionTree::ReadStrongClassifier(bdtXmlFileName, bdtName, pStrongClassifier));
+        pRegisteredStrongClassifier = pStrongClassifier;
     }
 
+    m_pStrongClassifier = pStrongClassifier;
     return STATUS_CODE_SUCCESS;
 }
 
@@ -176,6 +134,70 @@ double AdaBoostDecisionTree::CalculateScore(const LArMvaHelper::MvaFeatureVector
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AdaBoostDecisionTree::ReadStrongClassifier(
+    const std::string &bdtXmlFileName, const std::string &bdtName, std::shared_ptr<const StrongClassifier> &pStrongClassifier)
+{
+    TiXmlDocument xmlDocument(bdtXmlFileName);
+
+    if (!xmlDocument.LoadFile())
+    {
+        std::cout << "AdaBoostDecisionTree::Initialize - Invalid xml file." << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    const TiXmlHandle xmlDocumentHandle(&xmlDocument);
+    TiXmlNode *pContainerXmlNode(TiXmlHandle(xmlDocumentHandle).FirstChildElement().Element());
+
+    while (pContainerXmlNode)
+    {
+        if (pContainerXmlNode->ValueStr() != "AdaBoostDecisionTree")
+            return STATUS_CODE_FAILURE;
+
+        const TiXmlHandle currentHandle(pContainerXmlNode);
+
+        std::string currentName;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(currentHandle, "Name", currentName));
+
+        if (currentName.empty() || (currentName.size() > 1000))
+        {
+            std::cout << "AdaBoostDecisionTree::Initialize - Implausible AdaBoostDecisionTree name extracted from xml." << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        if (currentName == bdtName)
+            break;
+
+        pContainerXmlNode = pContainerXmlNode->NextSibling();
+    }
+
+    if (!pContainerXmlNode)
+    {
+        std::cout << "AdaBoostDecisionTree: Could not find an AdaBoostDecisionTree of name " << bdtName << std::endl;
+        return STATUS_CODE_NOT_FOUND;
+    }
+
+    const TiXmlHandle xmlHandle(pContainerXmlNode);
+
+    try
+    {
+        pStrongClassifier = std::make_shared<const StrongClassifier>(&xmlHandle);
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        if (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode())
+            std::cout << "AdaBoostDecisionTree: Initialization failure, unknown component in xml file." << std::endl;
+
+        if (STATUS_CODE_FAILURE == statusCodeException.GetStatusCode())
+            std::cout << "AdaBoostDecisionTree: Node definition does not contain expected leaf or branch variables." << std::endl;
+
+        return statusCodeException.GetStatusCode();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -16,6 +16,8 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace lar_content
@@ -52,7 +54,8 @@ public:
     ~AdaBoostDecisionTree();
 
     /**
-     *  @brief  Initialize the bdt model
+     *  @brief  Initialize the bdt model. The model is shared with any other bdt, in any pandora instance, currently holding the model
+     *          read from the same location and with the same name, and is released once the last bdt holding it is destroyed.
      *
      *  @param  parameterLocation the location of the model
      *  @param  bdtName the name of the model
@@ -322,7 +325,25 @@ private:
      */
     double CalculateScore(const LArMvaHelper::MvaFeatureVector &features) const;
 
-    StrongClassifier *m_pStrongClassifier; ///< Strong adaptive boost tree classifier
+    /**
+     *  @brief  Read the named strong classifier from an xml file
+     *
+     *  @param  bdtXmlFileName the xml file name
+     *  @param  bdtName the name of the model
+     *  @param  pStrongClassifier to receive the strong classifier
+     *
+     *  @return success
+     */
+    static pandora::StatusCode ReadStrongClassifier(
+        const std::string &bdtXmlFileName, const std::string &bdtName, std::shared_ptr<const StrongClassifier> &pStrongClassifier);
+
+    typedef std::pair<std::string, std::string> ModelKey;
+    typedef std::map<ModelKey, std::weak_ptr<const StrongClassifier>> ModelRegistry;
+
+    std::shared_ptr<const StrongClassifier> m_pStrongClassifier; ///< Strong adaptive boost tree classifier, shared between copies
+
+    static std::mutex m_modelRegistryMutex; ///< The mutex protecting the shared model registry
+    static ModelRegistry m_modelRegistry;   ///< The map from xml file name and model name to strong classifier, for all models in use
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
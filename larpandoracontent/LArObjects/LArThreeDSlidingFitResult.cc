@@ -40,16 +40,27 @@ ThreeDSlidingFitResult::ThreeDSlidingFitResult(const T *const pT, const unsigned
     m_minLayerDirection(0.f, 0.f, 0.f),
     m_maxLayerDirection(0.f, 0.f, 0.f)
 {
-    if (m_minLayer > m_maxLayer)
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    this->CalculateCombinedLayerFitInfo();
+}
 
-    const float minL(m_firstFitResult.GetL(m_minLayer));
-    const float maxL(m_firstFitResult.GetL(m_maxLayer));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(minL, m_minLayerPosition));
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(maxL, m_maxLayerPosition));
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(minL, m_minLayerDirection));
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(maxL, m_maxLayerDirection));
+ThreeDSlidingFitResult::ThreeDSlidingFitResult(const ThreeDSlidingFitResult &fitResult, const unsigned int layerWindow) :
+    m_primaryAxis(fitResult.m_primaryAxis),
+    m_axisIntercept(fitResult.m_axisIntercept),
+    m_axisDirection(fitResult.m_axisDirection),
+    m_firstOrthoDirection(fitResult.m_firstOrthoDirection),
+    m_secondOrthoDirection(fitResult.m_secondOrthoDirection),
+    m_firstFitResult(TwoDSlidingFitResult(fitResult.m_firstFitResult, layerWindow)),
+    m_secondFitResult(TwoDSlidingFitResult(fitResult.m_secondFitResult, layerWindow)),
+    m_minLayer(std::max(m_firstFitResult.GetMinLayer(), m_secondFitResult.GetMinLayer())),
+    m_maxLayer(std::min(m_firstFitResult.GetMaxLayer(), m_secondFitResult.GetMaxLayer())),
+    m_minLayerPosition(0.f, 0.f, 0.f),
+    m_maxLayerPosition(0.f, 0.f, 0.f),
+    m_minLayerDirection(0.f, 0.f, 0.f),
+    m_maxLayerDirection(0.f, 0.f, 0.f)
+{
+    this->CalculateCombinedLayerFitInfo();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -266,6 +277,22 @@ CartesianVector ThreeDSlidingFitResult::GetSeedDirection(const CartesianVector &
     throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeDSlidingFitResult::CalculateCombinedLayerFitInfo()
+{
+    if (m_minLayer > m_maxLayer)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    const float minL(m_firstFitResult.GetL(m_minLayer));
+    const float maxL(m_firstFitResult.GetL(m_maxLayer));
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(minL, m_minLayerPosition));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitPosition(maxL, m_maxLayerPosition));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(minL, m_minLayerDirection));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetGlobalFitDirection(maxL, m_maxLayerDirection));
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
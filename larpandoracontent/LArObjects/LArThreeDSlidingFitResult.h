@@ -33,6 +33,15 @@ public:
     template <typename T>
     ThreeDSlidingFitResult(const T *const pT, const unsigned int slidingFitWindow, const float slidingFitLayerPitch);
 
+    /**
+     *  @brief  Constructor reusing the primary axis and layer fit contributions of an existing fit result, avoiding a second pass
+     *          over the input positions when only the sliding fit window differs
+     *
+     *  @param  fitResult the existing fit result
+     *  @param  slidingFitWindow the sliding fit window
+     */
+    ThreeDSlidingFitResult(const ThreeDSlidingFitResult &fitResult, const unsigned int slidingFitWindow);
+
     /**
      *  @brief  Get the address of the cluster
      *
@@ -211,6 +220,11 @@ private:
      */
     static pandora::CartesianVector GetSeedDirection(const pandora::CartesianVector &axisDirection);
 
+    /**
+     *  @brief  Calculate the global positions and directions at the minimum and maximum combined layers
+     */
+    void CalculateCombinedLayerFitInfo();
+
     const pandora::TrackState m_primaryAxis;               ///< The primary axis position and direction
     const pandora::CartesianVector m_axisIntercept;        ///< The axis intercept position
     const pandora::CartesianVector m_axisDirection;        ///< The axis direction vector
@@ -47,8 +47,10 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     else
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
-        LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
+        // ATTN Per-thread storage for constituent hit positions is reused between fits, avoiding repeated allocations
+        thread_local CartesianPointVector constituentHitPointVector;
+        constituentHitPointVector.clear();
+        LArHitWidthHelper::GetConstituentHitPositions(pCluster, 0.5f, 1.f, true, constituentHitPointVector);
         this->FillLayerFitContributionMap(constituentHitPointVector);
     }
 
@@ -97,8 +99,10 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     else
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
-        LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
+        // ATTN Per-thread storage for constituent hit positions is reused between fits, avoiding repeated allocations
+        thread_local CartesianPointVector constituentHitPointVector;
+        constituentHitPointVector.clear();
+        LArHitWidthHelper::GetConstituentHitPositions(pCluster, 0.5f, 1.f, true, constituentHitPointVector);
         this->FillLayerFitContributionMap(constituentHitPointVector);
     }
 
@@ -140,6 +144,21 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const unsigned int layerFitHalfWindow
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TwoDSlidingFitResult::TwoDSlidingFitResult(const TwoDSlidingFitResult &fitResult, const unsigned int layerFitHalfWindow) :
+    m_pCluster(fitResult.m_pCluster),
+    m_layerFitHalfWindow(layerFitHalfWindow),
+    m_layerPitch(fitResult.m_layerPitch),
+    m_axisIntercept(fitResult.m_axisIntercept),
+    m_axisDirection(fitResult.m_axisDirection),
+    m_orthoDirection(fitResult.m_orthoDirection),
+    m_layerFitContributionMap(fitResult.m_layerFitContributionMap)
+{
+    this->PerformSlidingLinearFit();
+    this->FindSlidingFitSegments();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const pandora::Cluster *TwoDSlidingFitResult::GetCluster() const
 {
     if (!m_pCluster)
@@ -69,6 +69,15 @@ public:
         const pandora::CartesianVector &axisDirection, const pandora::CartesianVector &orthoDirection,
         const LayerFitContributionMap &layerFitContributionMap);
 
+    /**
+     *  @brief  Constructor reusing the primary axis and layer fit contribution map of an existing fit result, avoiding a second pass
+     *          over the input positions when only the layer fit half window differs
+     *
+     *  @param  fitResult the existing fit result
+     *  @param  layerFitHalfWindow the layer fit half window
+     */
+    TwoDSlidingFitResult(const TwoDSlidingFitResult &fitResult, const unsigned int layerFitHalfWindow);
+
     /**
      *  @brief  Get the address of the cluster, if originally provided
      *
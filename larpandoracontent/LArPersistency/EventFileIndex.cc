@@ -0,0 +1,81 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/EventFileIndex.cc
+ *
+ *  @brief  Implementation of the event file index class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArPersistency/EventFileIndex.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+EventFileIndex::Entry::Entry() :
+    m_eventNumber(0),
+    m_fileEventIndex(0),
+    m_byteOffset(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventFileIndex::ReadEntries(const std::string &indexFileName, EntryVector &entryVector)
+{
+    std::ifstream indexFile(indexFileName);
+
+    if (!indexFile.is_open())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    std::string line;
+
+    while (std::getline(indexFile, line))
+    {
+        if (line.empty())
+            continue;
+
+        Entry entry;
+        std::istringstream lineStream(line);
+
+        if (!(lineStream >> entry.m_eventNumber >> entry.m_fileEventIndex >> entry.m_byteOffset) || !(lineStream >> std::ws) ||
+            !std::getline(lineStream, entry.m_fileName) || entry.m_fileName.empty())
+        {
+            std::cout << "EventFileIndex: Unable to parse line \"" << line << "\" in index file " << indexFileName << std::endl;
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
+
+        entryVector.push_back(entry);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventFileIndex::AppendEntry(const std::string &indexFileName, const Entry &entry)
+{
+    std::ofstream indexFile(indexFileName, std::ios::app);
+
+    if (!indexFile.is_open())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    indexFile << entry.m_eventNumber << " " << entry.m_fileEventIndex << " " << entry.m_byteOffset << " " << entry.m_fileName << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventFileIndex::ClearEntries(const std::string &indexFileName)
+{
+    std::ofstream indexFile(indexFileName, std::ios::trunc);
+
+    if (!indexFile.is_open())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+}
+
+} // namespace lar_content
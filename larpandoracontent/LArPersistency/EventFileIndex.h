@@ -0,0 +1,71 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/EventFileIndex.h
+ *
+ *  @brief  Header file for the event file index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_FILE_INDEX_H
+#define LAR_EVENT_FILE_INDEX_H 1
+
+#include <ios>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventFileIndex class, describing a sidecar index for a set of event files. The index is a text file with one line per event,
+ *          holding the event number, the index of the event within its event file, the byte offset of the start of the event within its
+ *          event file and the event file name.
+ */
+class EventFileIndex
+{
+public:
+    /**
+     *  @brief  Entry class, describing the location of a single event
+     */
+    class Entry
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Entry();
+
+        unsigned int m_eventNumber;    ///< The event number, counting all events in the index
+        unsigned int m_fileEventIndex; ///< The index of the event within its event file
+        std::streamoff m_byteOffset;   ///< The byte offset of the start of the event within its event file
+        std::string m_fileName;        ///< The name of the event file
+    };
+
+    typedef std::vector<Entry> EntryVector;
+
+    /**
+     *  @brief  Read all entries from an index file
+     *
+     *  @param  indexFileName the index file name
+     *  @param  entryVector to receive the entries, in index file order
+     */
+    static void ReadEntries(const std::string &indexFileName, EntryVector &entryVector);
+
+    /**
+     *  @brief  Append an entry to an index file, creating the index file if required
+     *
+     *  @param  indexFileName the index file name
+     *  @param  entry the entry
+     */
+    static void AppendEntry(const std::string &indexFileName, const Entry &entry);
+
+    /**
+     *  @brief  Remove all entries from an index file, creating the index file if required
+     *
+     *  @param  indexFileName the index file name
+     */
+    static void ClearEntries(const std::string &indexFileName);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_FILE_INDEX_H
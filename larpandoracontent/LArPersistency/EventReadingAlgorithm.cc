@@ -6,17 +6,28 @@
  *  $Log: $
  */
 
+#include "Api/PandoraApi.h"
+
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "Persistency/BinaryFileReader.h"
 #include "Persistency/XmlFileReader.h"
 
+#include "larpandoracontent/LArContent.h"
+
+#include "larpandoracontent/LArHelpers/LArFileHelper.h"
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
 
 #include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
 
+#include "larpandoracontent/LArPlugins/LArPseudoLayerPlugin.h"
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include <algorithm>
+#include <set>
 
 using namespace pandora;
 
@@ -29,7 +40,24 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
     m_larCaloHitVersion(1),
     m_useLArMCParticles(true),
     m_larMCParticleVersion(2),
-    m_pEventFileReader(nullptr)
+    m_pEventFileReader(nullptr),
+    m_nShards(1),
+    m_shardIndex(0),
+    m_interleaveShards(false),
+    m_nextIndexedEvent(0),
+    m_nextFileEventIndex(0),
+    m_nPrefetchEvents(0),
+    m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
+    m_pStagingPandora(nullptr),
+    m_stopPrefetching(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventReadingAlgorithm::PrefetchedEvent::PrefetchedEvent() :
+    m_statusCode(STATUS_CODE_SUCCESS),
+    m_isEndOfInput(false)
 {
 }
 
@@ -37,7 +65,11 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
 
 EventReadingAlgorithm::~EventReadingAlgorithm()
 {
+    this->StopPrefetching();
+
+    // ATTN When reading ahead, the event file reader refers to the staging instance, so must be deleted first
     delete m_pEventFileReader;
+    delete m_pStagingPandora;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -64,7 +96,22 @@ StatusCode EventReadingAlgorithm::Initialize()
         }
     }
 
-    if (!m_eventFileName.empty())
+    if (!m_eventIndexFileName.empty())
+    {
+        try
+        {
+            this->SelectIndexedEvents();
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            std::cout << "EventReadingAlgorithm: Unable to read event index file " << m_eventIndexFileName << std::endl;
+            return statusCodeException.GetStatusCode();
+        }
+    }
+
+    // ATTN When reading ahead, the event file reader is instead created for the staging instance, when processing the first event.
+    // When reading indexed events, the event file reader is created for the file containing the first selected event, on demand.
+    if (!m_eventFileName.empty() && m_eventIndexFileName.empty() && (0 == m_nPrefetchEvents))
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
@@ -77,7 +124,242 @@ StatusCode EventReadingAlgorithm::Initialize()
 
 StatusCode EventReadingAlgorithm::Run()
 {
-    if ((nullptr != m_pEventFileReader) && !m_eventFileName.empty())
+    const bool hasEventInput(!m_eventFileName.empty() || !m_eventIndexFileName.empty());
+
+    if ((m_nPrefetchEvents > 0) && hasEventInput)
+    {
+        if (!m_prefetchThread.joinable())
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->StartPrefetching());
+
+        PrefetchedEvent prefetchedEvent;
+        {
+            std::unique_lock<std::mutex> lock(m_prefetchMutex);
+            m_prefetchCondition.wait(lock, [this] { return !m_prefetchedEventQueue.empty(); });
+            prefetchedEvent = std::move(m_prefetchedEventQueue.front());
+            m_prefetchedEventQueue.pop_front();
+        }
+        m_prefetchCondition.notify_all();
+
+        if (prefetchedEvent.m_isEndOfInput)
+            throw StopProcessingException("All event files processed");
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, prefetchedEvent.m_statusCode);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateStagedEvent(prefetchedEvent.m_stagedEvent));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
+    }
+    else if (hasEventInput && ((nullptr != m_pEventFileReader) || !m_eventIndexFileName.empty()))
+    {
+        this->ReadNextEvent();
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventReadingAlgorithm::StartPrefetching()
+{
+    try
+    {
+        m_pStagingPandora = this->CreateStagingInstance();
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "EventReadingAlgorithm: Exception during initialization of staging instance " << statusCodeException.ToString()
+                  << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
+    if (m_eventIndexFileName.empty())
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
+    }
+
+    m_stopPrefetching = false;
+    m_prefetchThread = std::thread(&EventReadingAlgorithm::PrefetchEvents, this);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::StopPrefetching()
+{
+    if (!m_prefetchThread.joinable())
+        return;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_prefetchMutex);
+        m_stopPrefetching = true;
+    }
+
+    m_prefetchCondition.notify_all();
+    m_prefetchThread.join();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::PrefetchEvents()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_prefetchMutex);
+            m_prefetchCondition.wait(lock, [this] { return m_stopPrefetching || (m_prefetchedEventQueue.size() < m_nPrefetchEvents); });
+
+            if (m_stopPrefetching)
+                return;
+        }
+
+        // ATTN A failure to read or stage one event is reported for that event alone, whereupon reading ahead continues
+        PrefetchedEvent prefetchedEvent;
+        this->PrefetchEvent(prefetchedEvent);
+        const bool isFinished(prefetchedEvent.m_isEndOfInput);
+
+        {
+            const std::lock_guard<std::mutex> lock(m_prefetchMutex);
+            m_prefetchedEventQueue.push_back(std::move(prefetchedEvent));
+        }
+
+        m_prefetchCondition.notify_all();
+
+        if (isFinished)
+            return;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::PrefetchEvent(PrefetchedEvent &prefetchedEvent)
+{
+    try
+    {
+        // ATTN If a previous failure left no event file reader, reading continues from the next event file
+        if (m_eventIndexFileName.empty() && !m_pEventFileReader)
+        {
+            this->MoveToNextEventFile();
+        }
+        else
+        {
+            this->ReadNextEvent();
+        }
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pStagingPandora));
+        EventStagingRegistry::TakeStagedEvent(m_pStagingPandora, prefetchedEvent.m_stagedEvent);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pStagingPandora));
+    }
+    catch (const StopProcessingException &)
+    {
+        prefetchedEvent.m_isEndOfInput = true;
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "EventReadingAlgorithm: Exception whilst reading ahead " << statusCodeException.ToString() << std::endl;
+        prefetchedEvent.m_statusCode = statusCodeException.GetStatusCode();
+
+        const StatusCode resetStatusCode(PandoraApi::Reset(*m_pStagingPandora));
+
+        if (STATUS_CODE_SUCCESS != resetStatusCode)
+            std::cout << "EventReadingAlgorithm: Unable to reset staging instance " << StatusCodeToString(resetStatusCode) << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventReadingAlgorithm::CreateStagedEvent(const EventStagingRegistry::StagedEvent &stagedEvent) const
+{
+    const LArMCParticleFactory mcParticleFactory(m_larMCParticleVersion);
+    const LArCaloHitFactory caloHitFactory(m_larCaloHitVersion);
+
+    for (const LArMCParticleParameters &parameters : stagedEvent.m_mcParticleParameters)
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(this->GetPandora(), parameters, mcParticleFactory));
+
+    for (const LArCaloHitParameters &parameters : stagedEvent.m_caloHitParameters)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(this->GetPandora(), parameters, caloHitFactory));
+
+    for (const EventStagingRegistry::MCParentDaughter &relationship : stagedEvent.m_mcParentDaughterRelationships)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetMCParentDaughterRelationship(
+                this->GetPandora(), relationship.m_pParentAddress, relationship.m_pDaughterAddress));
+    }
+
+    for (const EventStagingRegistry::CaloHitToMCParticle &relationship : stagedEvent.m_caloHitToMCParticleRelationships)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::SetCaloHitToMCParticleRelationship(this->GetPandora(), relationship.m_pCaloHitParentAddress,
+                relationship.m_pMCParticleParentAddress, relationship.m_mcParticleWeight));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Pandora *EventReadingAlgorithm::CreateStagingInstance() const
+{
+    const Pandora *const pPandora(new Pandora("EventStagingInstance"));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterAlgorithms(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArContent::RegisterBasicPlugins(*pPandora));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new lar_content::LArPseudoLayerPlugin));
+    PANDORA_THROW_RESULT_IF(
+        STATUS_CODE_SUCCESS, !=, PandoraApi::SetLArTransformationPlugin(*pPandora, new lar_content::LArRotationalTransformationPlugin));
+
+    // The geometry, matching that of this instance
+    LArGeometryHelper::CopyGeometry(this->GetPandora(), *pPandora);
+
+    // Configuration
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, m_prefetchSettingsFile));
+    return pPandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::SelectIndexedEvents()
+{
+    EventFileIndex::EntryVector entryVector;
+    EventFileIndex::ReadEntries(m_eventIndexFileName, entryVector);
+
+    if (!m_eventNumbers.empty())
+    {
+        const std::set<unsigned int> eventNumberSet(m_eventNumbers.begin(), m_eventNumbers.end());
+        entryVector.erase(std::remove_if(entryVector.begin(), entryVector.end(),
+                              [&eventNumberSet](const EventFileIndex::Entry &entry) { return !eventNumberSet.count(entry.m_eventNumber); }),
+            entryVector.end());
+    }
+
+    const size_t nEntries(entryVector.size());
+    m_indexedEvents.clear();
+
+    if (m_interleaveShards)
+    {
+        // Each shard receives every n-th selected event, so that shards processed concurrently progress through the events together
+        for (size_t iEntry = m_shardIndex + static_cast<size_t>(m_skipToEvent) * m_nShards; iEntry < nEntries; iEntry += m_nShards)
+            m_indexedEvents.push_back(entryVector.at(iEntry));
+    }
+    else
+    {
+        // Each shard receives a contiguous block of the selected events, so as to minimise the number of event files each shard must open
+        const size_t firstEntry(std::min(nEntries, (nEntries * m_shardIndex) / m_nShards + m_skipToEvent));
+        const size_t lastEntry((nEntries * (m_shardIndex + 1)) / m_nShards);
+
+        if (firstEntry < lastEntry)
+            m_indexedEvents.insert(m_indexedEvents.end(), entryVector.begin() + firstEntry, entryVector.begin() + lastEntry);
+    }
+
+    m_nextIndexedEvent = 0;
+    std::cout << "EventReadingAlgorithm: Selected " << m_indexedEvents.size() << " events from event index file " << m_eventIndexFileName
+              << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::ReadNextEvent()
+{
+    if (m_eventIndexFileName.empty())
     {
         try
         {
@@ -88,10 +370,27 @@ StatusCode EventReadingAlgorithm::Run()
             this->MoveToNextEventFile();
         }
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
+        return;
     }
 
-    return STATUS_CODE_SUCCESS;
+    if (m_nextIndexedEvent >= m_indexedEvents.size())
+        throw StopProcessingException("All indexed events processed");
+
+    const EventFileIndex::Entry &entry(m_indexedEvents.at(m_nextIndexedEvent++));
+
+    if (!m_pEventFileReader || (entry.m_fileName != m_eventFileName))
+    {
+        m_eventFileName = entry.m_fileName;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+        m_nextFileEventIndex = 0;
+    }
+
+    // ATTN Consecutive events are read without repositioning the event file reader
+    if (entry.m_fileEventIndex != m_nextFileEventIndex)
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(entry.m_fileEventIndex));
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->ReadEvent());
+    m_nextFileEventIndex = entry.m_fileEventIndex + 1;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -125,13 +424,16 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
     std::cout << "EventReadingAlgorithm: Processing event file: " << fileName << std::endl;
     const FileType eventFileType(this->GetFileType(fileName));
 
+    // ATTN When reading ahead, events are read into the staging instance
+    const Pandora &pandora(m_pStagingPandora ? *m_pStagingPandora : this->GetPandora());
+
     if (BINARY == eventFileType)
     {
-        m_pEventFileReader = new BinaryFileReader(this->GetPandora(), fileName);
+        m_pEventFileReader = new BinaryFileReader(pandora, fileName);
     }
     else if (XML == eventFileType)
     {
-        m_pEventFileReader = new XmlFileReader(this->GetPandora(), fileName);
+        m_pEventFileReader = new XmlFileReader(pandora, fileName);
     }
     else
     {
@@ -219,7 +521,44 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SkipToEvent", m_skipToEvent));
     }
 
-    if (m_geometryFileName.empty() && m_eventFileName.empty())
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EventIndexFileName", m_eventIndexFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NShards", m_nShards));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ShardIndex", m_shardIndex));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InterleaveShards", m_interleaveShards));
+
+    if (pExternalParameters && pExternalParameters->m_nShards.IsInitialized())
+        m_nShards = pExternalParameters->m_nShards.Get();
+
+    if (pExternalParameters && pExternalParameters->m_shardIndex.IsInitialized())
+        m_shardIndex = pExternalParameters->m_shardIndex.Get();
+
+    if (pExternalParameters && pExternalParameters->m_interleaveShards.IsInitialized())
+        m_interleaveShards = pExternalParameters->m_interleaveShards.Get();
+
+    if (m_eventIndexFileName.empty() && (m_nShards > 1))
+    {
+        std::cout << "EventReadingAlgorithm - dividing events into shards requires an event index file." << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    if (!m_eventIndexFileName.empty())
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "EventNumbers", m_eventNumbers));
+
+        if ((0 == m_nShards) || (m_shardIndex >= m_nShards))
+        {
+            std::cout << "EventReadingAlgorithm - invalid shard index " << m_shardIndex << " for " << m_nShards << " shards."
+                      << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+    }
+
+    if (m_geometryFileName.empty() && m_eventFileName.empty() && m_eventIndexFileName.empty())
     {
         std::cout << "EventReadingAlgorithm - nothing to do; neither geometry nor event file specified." << std::endl;
         return STATUS_CODE_NOT_INITIALIZED;
@@ -236,6 +575,23 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseLArMCParticles", m_useLArMCParticles));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrefetchEvents", m_nPrefetchEvents));
+
+    if (m_nPrefetchEvents > 0)
+    {
+        if (!m_useLArCaloHits || !m_useLArMCParticles)
+        {
+            std::cout << "EventReadingAlgorithm - reading ahead requires lar calo hits and lar mc particles." << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "PrefetchSettingsFile", m_prefetchSettingsFile));
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+            XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
+        m_prefetchSettingsFile = LArFileHelper::FindFileInPath(m_prefetchSettingsFile, m_filePathEnvironmentVariable);
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
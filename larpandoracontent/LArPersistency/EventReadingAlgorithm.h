@@ -14,6 +14,14 @@
 
 #include "Persistency/PandoraIO.h"
 
+#include "larpandoracontent/LArPersistency/EventFileIndex.h"
+#include "larpandoracontent/LArPersistency/EventStagingRegistry.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace pandora
 {
 class FileReader;
@@ -46,15 +54,83 @@ public:
     class ExternalEventReadingParameters : public pandora::ExternalParameters
     {
     public:
-        std::string m_geometryFileName;   ///< Name of the file containing geometry information
-        std::string m_eventFileNameList;  ///< Colon-separated list of file names to be processed
-        pandora::InputUInt m_skipToEvent; ///< Index of first event to consider in input file
+        std::string m_geometryFileName;        ///< Name of the file containing geometry information
+        std::string m_eventFileNameList;       ///< Colon-separated list of file names to be processed
+        pandora::InputUInt m_skipToEvent;      ///< Index of first event to consider in input file
+        pandora::InputUInt m_nShards;          ///< The number of shards into which the indexed events are divided
+        pandora::InputUInt m_shardIndex;       ///< The index of the shard of indexed events to process
+        pandora::InputBool m_interleaveShards; ///< Whether shards receive every n-th indexed event, rather than a contiguous block
     };
 
 private:
+    /**
+     *  @brief  PrefetchedEvent class, holding an event read ahead on the background thread
+     */
+    class PrefetchedEvent
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        PrefetchedEvent();
+
+        EventStagingRegistry::StagedEvent m_stagedEvent; ///< The staged event content
+        pandora::StatusCode m_statusCode;                ///< The status code from reading the event
+        bool m_isEndOfInput;                             ///< Whether all event files have been processed
+    };
+
+    typedef std::deque<PrefetchedEvent> PrefetchedEventQueue;
+
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Start reading events ahead on a background thread, into a dedicated staging instance
+     */
+    pandora::StatusCode StartPrefetching();
+
+    /**
+     *  @brief  Stop reading events ahead, waiting for the background thread to finish
+     */
+    void StopPrefetching();
+
+    /**
+     *  @brief  Background thread loop, reading and staging events whenever the queue of prefetched events has space, until all events
+     *          have been read or prefetching is stopped. A failure to read or stage an event is queued in place of that event.
+     */
+    void PrefetchEvents();
+
+    /**
+     *  @brief  Read the next event into the staging instance and extract its content, resetting the staging instance on failure
+     *
+     *  @param  prefetchedEvent to receive the prefetched event
+     */
+    void PrefetchEvent(PrefetchedEvent &prefetchedEvent);
+
+    /**
+     *  @brief  Create the objects described by a staged event within this pandora instance
+     *
+     *  @param  stagedEvent the staged event
+     */
+    pandora::StatusCode CreateStagedEvent(const EventStagingRegistry::StagedEvent &stagedEvent) const;
+
+    /**
+     *  @brief  Create the staging instance, with geometry matching this pandora instance, configured using the prefetch settings file
+     *
+     *  @return the address of the staging pandora instance
+     */
+    const pandora::Pandora *CreateStagingInstance() const;
+
+    /**
+     *  @brief  Read the event index file and select the events to be processed, applying the event number list, shard and skip settings
+     */
+    void SelectIndexedEvents();
+
+    /**
+     *  @brief  Read the next event, either the next event in the event files or the next selected event in the event index
+     */
+    void ReadNextEvent();
+
     /**
      *  @brief  Proceed to process next event file named in the input list
      */
@@ -89,6 +165,25 @@ private:
     unsigned int m_larMCParticleVersion; ///< LArMCParticle version for LArMCParticleFactory
 
     pandora::FileReader *m_pEventFileReader; ///< Address of the event file reader
+
+    std::string m_eventIndexFileName;            ///< Name of the event index file, if any, used to locate the events to be processed
+    std::vector<unsigned int> m_eventNumbers;    ///< The event numbers to process from the event index, or empty to process all events
+    unsigned int m_nShards;                      ///< The number of shards into which the indexed events are divided
+    unsigned int m_shardIndex;                   ///< The index of the shard of indexed events to process
+    bool m_interleaveShards;                     ///< Whether shards receive every n-th indexed event, rather than a contiguous block
+    EventFileIndex::EntryVector m_indexedEvents; ///< The selected indexed events, in processing order
+    unsigned int m_nextIndexedEvent;             ///< The position of the next selected indexed event to process
+    unsigned int m_nextFileEventIndex;           ///< The index, within the current event file, of the next event the reader will read
+
+    unsigned int m_nPrefetchEvents;              ///< The number of events to read ahead on a background thread, zero to read synchronously
+    std::string m_prefetchSettingsFile;          ///< The settings file for the staging instance, which should run LArEventStaging
+    std::string m_filePathEnvironmentVariable;   ///< The environment variable providing a list of paths to xml files
+    const pandora::Pandora *m_pStagingPandora;   ///< Address of the staging instance, into which events are read ahead
+    std::thread m_prefetchThread;                ///< The background thread reading events ahead
+    std::mutex m_prefetchMutex;                  ///< The mutex protecting the prefetched event queue
+    std::condition_variable m_prefetchCondition; ///< The condition variable signalling changes to the prefetched event queue
+    PrefetchedEventQueue m_prefetchedEventQueue; ///< The queue of prefetched events, in file order
+    bool m_stopPrefetching;                      ///< Whether the background thread should stop reading events ahead
 };
 
 } // namespace lar_content
@@ -0,0 +1,111 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/EventStagingAlgorithm.cc
+ *
+ *  @brief  Implementation of the event staging algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+
+#include "larpandoracontent/LArPersistency/EventStagingAlgorithm.h"
+#include "larpandoracontent/LArPersistency/EventStagingRegistry.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+EventStagingAlgorithm::EventStagingAlgorithm()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventStagingAlgorithm::Run()
+{
+    EventStagingRegistry::StagedEvent stagedEvent;
+
+    const MCParticleList *pMCParticleList(nullptr);
+    const StatusCode mcStatusCode(PandoraContentApi::GetCurrentList(*this, pMCParticleList));
+
+    if ((STATUS_CODE_SUCCESS != mcStatusCode) && (STATUS_CODE_NOT_INITIALIZED != mcStatusCode))
+        return mcStatusCode;
+
+    if (pMCParticleList)
+    {
+        MCParticleVector mcParticleVector(pMCParticleList->begin(), pMCParticleList->end());
+        std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+
+        // ATTN The parent addresses are those of the objects in this instance, and serve only to identify objects within the staged event
+        for (const MCParticle *const pMCParticle : mcParticleVector)
+        {
+            const LArMCParticle *const pLArMCParticle(dynamic_cast<const LArMCParticle *>(pMCParticle));
+
+            if (!pLArMCParticle)
+            {
+                std::cout << "EventStagingAlgorithm: Only LArMCParticles can be staged" << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+
+            LArMCParticleParameters parameters;
+            pLArMCParticle->FillParameters(parameters);
+            stagedEvent.m_mcParticleParameters.push_back(parameters);
+
+            for (const MCParticle *const pDaughterMCParticle : pMCParticle->GetDaughterList())
+                stagedEvent.m_mcParentDaughterRelationships.push_back({pMCParticle, pDaughterMCParticle});
+        }
+    }
+
+    const CaloHitList *pCaloHitList(nullptr);
+    const StatusCode caloHitStatusCode(PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    if ((STATUS_CODE_SUCCESS != caloHitStatusCode) && (STATUS_CODE_NOT_INITIALIZED != caloHitStatusCode))
+        return caloHitStatusCode;
+
+    if (pCaloHitList)
+    {
+        for (const CaloHit *const pCaloHit : *pCaloHitList)
+        {
+            const LArCaloHit *const pLArCaloHit(dynamic_cast<const LArCaloHit *>(pCaloHit));
+
+            if (!pLArCaloHit)
+            {
+                std::cout << "EventStagingAlgorithm: Only LArCaloHits can be staged" << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+
+            LArCaloHitParameters parameters;
+            pLArCaloHit->FillParameters(parameters);
+            stagedEvent.m_caloHitParameters.push_back(parameters);
+
+            MCParticleVector mcParticleVector;
+            for (const auto &weightMapEntry : pCaloHit->GetMCParticleWeightMap())
+                mcParticleVector.push_back(weightMapEntry.first);
+            std::sort(mcParticleVector.begin(), mcParticleVector.end(), LArMCParticleHelper::SortByMomentum);
+
+            for (const MCParticle *const pMCParticle : mcParticleVector)
+            {
+                const float weight(pCaloHit->GetMCParticleWeightMap().at(pMCParticle));
+                stagedEvent.m_caloHitToMCParticleRelationships.push_back({pCaloHit, pMCParticle, weight});
+            }
+        }
+    }
+
+    EventStagingRegistry::SetStagedEvent(&this->GetPandora(), stagedEvent);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventStagingAlgorithm::ReadSettings(const TiXmlHandle /*xmlHandle*/)
+{
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,34 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/EventStagingAlgorithm.h
+ *
+ *  @brief  Header file for the event staging algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_STAGING_ALGORITHM_H
+#define LAR_EVENT_STAGING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventStagingAlgorithm class, run within a staging instance to record the decoded event content in the event staging registry
+ */
+class EventStagingAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    EventStagingAlgorithm();
+
+private:
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_STAGING_ALGORITHM_H
@@ -0,0 +1,43 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/EventStagingRegistry.cc
+ *
+ *  @brief  Implementation of the event staging registry class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArPersistency/EventStagingRegistry.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+std::mutex EventStagingRegistry::m_mutex;
+EventStagingRegistry::StagedEventMap EventStagingRegistry::m_stagedEventMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventStagingRegistry::SetStagedEvent(const Pandora *const pStagingPandora, const StagedEvent &stagedEvent)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_stagedEventMap[pStagingPandora] = stagedEvent;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventStagingRegistry::TakeStagedEvent(const Pandora *const pStagingPandora, StagedEvent &stagedEvent)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    StagedEventMap::iterator iter(m_stagedEventMap.find(pStagingPandora));
+
+    if (m_stagedEventMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    stagedEvent = std::move(iter->second);
+    m_stagedEventMap.erase(iter);
+}
+
+} // namespace lar_content
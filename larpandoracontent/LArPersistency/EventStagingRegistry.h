@@ -0,0 +1,98 @@
+/**
+ *  @file   larpandoracontent/LArPersistency/EventStagingRegistry.h
+ *
+ *  @brief  Header file for the event staging registry class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_STAGING_REGISTRY_H
+#define LAR_EVENT_STAGING_REGISTRY_H 1
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+#include "larpandoracontent/LArObjects/LArMCParticle.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  EventStagingRegistry class, used to pass the decoded content of an event from a staging Pandora instance to the instance
+ *          that will reconstruct it. Each staging instance owns a single entry, so staging instances may access the registry concurrently.
+ */
+class EventStagingRegistry
+{
+public:
+    /**
+     *  @brief  CaloHitToMCParticle class, describing a single calo hit to mc particle relationship
+     */
+    class CaloHitToMCParticle
+    {
+    public:
+        const void *m_pCaloHitParentAddress;    ///< The parent address of the calo hit
+        const void *m_pMCParticleParentAddress; ///< The parent address of the mc particle
+        float m_mcParticleWeight;               ///< The weight of the mc particle contribution to the calo hit
+    };
+
+    /**
+     *  @brief  MCParentDaughter class, describing a single mc particle parent-daughter relationship
+     */
+    class MCParentDaughter
+    {
+    public:
+        const void *m_pParentAddress;   ///< The parent address of the parent mc particle
+        const void *m_pDaughterAddress; ///< The parent address of the daughter mc particle
+    };
+
+    typedef std::vector<LArCaloHitParameters> CaloHitParametersVector;
+    typedef std::vector<LArMCParticleParameters> MCParticleParametersVector;
+    typedef std::vector<CaloHitToMCParticle> CaloHitToMCParticleVector;
+    typedef std::vector<MCParentDaughter> MCParentDaughterVector;
+
+    /**
+     *  @brief  StagedEvent class, holding the object parameters and relationships needed to recreate an event
+     */
+    class StagedEvent
+    {
+    public:
+        CaloHitParametersVector m_caloHitParameters;                  ///< The calo hit parameters
+        MCParticleParametersVector m_mcParticleParameters;            ///< The mc particle parameters
+        MCParentDaughterVector m_mcParentDaughterRelationships;       ///< The mc particle parent-daughter relationships
+        CaloHitToMCParticleVector m_caloHitToMCParticleRelationships; ///< The calo hit to mc particle relationships
+    };
+
+    /**
+     *  @brief  Set the staged event for a staging instance, replacing any existing staged event
+     *
+     *  @param  pStagingPandora address of the staging pandora instance
+     *  @param  stagedEvent the staged event
+     */
+    static void SetStagedEvent(const pandora::Pandora *const pStagingPandora, const StagedEvent &stagedEvent);
+
+    /**
+     *  @brief  Take the staged event for a staging instance, removing it from the registry
+     *
+     *  @param  pStagingPandora address of the staging pandora instance
+     *  @param  stagedEvent to receive the staged event
+     */
+    static void TakeStagedEvent(const pandora::Pandora *const pStagingPandora, StagedEvent &stagedEvent);
+
+private:
+    typedef std::unordered_map<const pandora::Pandora *, StagedEvent> StagedEventMap;
+
+    static std::mutex m_mutex;              ///< The mutex protecting the staged event map
+    static StagedEventMap m_stagedEventMap; ///< The map from staging pandora instance to staged event
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_STAGING_REGISTRY_H
@@ -17,8 +17,11 @@
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
 
+#include "larpandoracontent/LArPersistency/EventFileIndex.h"
 #include "larpandoracontent/LArPersistency/EventWritingAlgorithm.h"
 
+#include <sys/stat.h>
+
 using namespace pandora;
 
 namespace lar_content
@@ -32,6 +35,8 @@ EventWritingAlgorithm::EventWritingAlgorithm() :
     m_shouldWriteGeometry(false),
     m_writtenGeometry(false),
     m_shouldWriteEvents(true),
+    m_nIndexedEvents(0),
+    m_nIndexedFileEvents(0),
     m_shouldWriteMCRelationships(true),
     m_shouldWriteTrackRelationships(true),
     m_shouldOverwriteEventFile(false),
@@ -115,6 +120,25 @@ StatusCode EventWritingAlgorithm::Initialize()
 
         if (m_useLArMCParticles)
             m_pEventFileWriter->SetFactory(new LArMCParticleFactory);
+
+        if (!m_eventIndexFileName.empty())
+        {
+            try
+            {
+                if (m_shouldOverwriteEventFile)
+                {
+                    EventFileIndex::ClearEntries(m_eventIndexFileName);
+                }
+                else
+                {
+                    this->CountIndexedEvents();
+                }
+            }
+            catch (const StatusCodeException &statusCodeException)
+            {
+                return statusCodeException.GetStatusCode();
+            }
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -146,8 +170,22 @@ StatusCode EventWritingAlgorithm::Run()
         const MCParticleList *pMCParticleList = nullptr;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pMCParticleList));
 
+        // ATTN The binary file writer repositions its stream at the end of each event, so all previous events are already in the event file
+        struct stat fileInfo;
+        const std::streamoff byteOffset((0 == stat(m_eventFileName.c_str(), &fileInfo)) ? fileInfo.st_size : 0);
+
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
             m_pEventFileWriter->WriteEvent(*pCaloHitList, *pTrackList, *pMCParticleList, m_shouldWriteMCRelationships, m_shouldWriteTrackRelationships));
+
+        if (!m_eventIndexFileName.empty())
+        {
+            EventFileIndex::Entry entry;
+            entry.m_eventNumber = m_nIndexedEvents++;
+            entry.m_fileEventIndex = m_nIndexedFileEvents++;
+            entry.m_byteOffset = byteOffset;
+            entry.m_fileName = m_eventFileName;
+            EventFileIndex::AppendEntry(m_eventIndexFileName, entry);
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -155,6 +193,31 @@ StatusCode EventWritingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventWritingAlgorithm::CountIndexedEvents()
+{
+    EventFileIndex::EntryVector entryVector;
+
+    try
+    {
+        EventFileIndex::ReadEntries(m_eventIndexFileName, entryVector);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        if (STATUS_CODE_NOT_FOUND != statusCodeException.GetStatusCode())
+            throw statusCodeException;
+    }
+
+    for (const EventFileIndex::Entry &entry : entryVector)
+    {
+        m_nIndexedEvents = std::max(m_nIndexedEvents, entry.m_eventNumber + 1);
+
+        if (entry.m_fileName == m_eventFileName)
+            m_nIndexedFileEvents = std::max(m_nIndexedFileEvents, entry.m_fileEventIndex + 1);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool EventWritingAlgorithm::PassNuanceCodeFilter() const
 {
     const MCParticleList *pMCParticleList = nullptr;
@@ -311,6 +374,15 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
             std::cout << "EventReadingAlgorithm: Unknown event file type specified " << std::endl;
             return STATUS_CODE_INVALID_PARAMETER;
         }
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EventIndexFileName", m_eventIndexFileName));
+
+        if (!m_eventIndexFileName.empty() && (BINARY != m_eventFileType))
+        {
+            std::cout << "EventWritingAlgorithm: Event index file requires a binary event file " << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
     }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
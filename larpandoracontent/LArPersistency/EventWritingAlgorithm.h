@@ -63,6 +63,11 @@ private:
      */
     bool PassNeutrinoVertexFilter() const;
 
+    /**
+     *  @brief  Count the events already listed in the event index file, in total and for the output event file
+     */
+    void CountIndexedEvents();
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     pandora::FileType m_geometryFileType; ///< The geometry file type
@@ -78,6 +83,10 @@ private:
     bool m_shouldWriteEvents;    ///< Whether to write events to a specified file
     std::string m_eventFileName; ///< Name of the output event file
 
+    std::string m_eventIndexFileName;  ///< Name of the output event index file, if any, listing the location of each event written
+    unsigned int m_nIndexedEvents;     ///< The number of events listed in the event index file
+    unsigned int m_nIndexedFileEvents; ///< The number of events listed in the event index file for the output event file
+
     bool m_shouldWriteMCRelationships;    ///< Whether to write mc relationship information to the events file
     bool m_shouldWriteTrackRelationships; ///< Whether to write track relationship information to the events file
 
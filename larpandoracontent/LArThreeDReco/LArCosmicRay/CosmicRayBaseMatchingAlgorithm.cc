@@ -18,6 +18,13 @@ using namespace pandora;
 namespace lar_content
 {
 
+CosmicRayBaseMatchingAlgorithm::CosmicRayBaseMatchingAlgorithm() :
+    m_useClusterAttributeCache(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CosmicRayBaseMatchingAlgorithm::Run()
 {
     // Get the available clusters for each view
@@ -26,22 +33,29 @@ StatusCode CosmicRayBaseMatchingAlgorithm::Run()
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetAvailableClusters(m_inputClusterListNameV, availableClustersV));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetAvailableClusters(m_inputClusterListNameW, availableClustersW));
 
-    // Select clean clusters in each view
-    ClusterVector cleanClustersU, cleanClustersV, cleanClustersW;
-    this->SelectCleanClusters(availableClustersU, cleanClustersU);
-    this->SelectCleanClusters(availableClustersV, cleanClustersV);
-    this->SelectCleanClusters(availableClustersW, cleanClustersW);
-
-    // Build associations between pairs of views
-    ClusterAssociationMap matchedClusterUV, matchedClusterVW, matchedClusterWU;
-    this->MatchClusters(cleanClustersU, cleanClustersV, matchedClusterUV);
-    this->MatchClusters(cleanClustersV, cleanClustersW, matchedClusterVW);
-    this->MatchClusters(cleanClustersW, cleanClustersU, matchedClusterWU);
+    ParticleList particleList;
+    {
+        // ATTN No cluster is modified until the particles are built, so derived cluster quantities may be cached whilst matching
+        const LArClusterHelper::ClusterAttributeCache clusterAttributeCache(m_useClusterAttributeCache);
+
+        // Select clean clusters in each view
+        ClusterVector cleanClustersU, cleanClustersV, cleanClustersW;
+        this->SelectCleanClusters(availableClustersU, cleanClustersU);
+        this->SelectCleanClusters(availableClustersV, cleanClustersV);
+        this->SelectCleanClusters(availableClustersW, cleanClustersW);
+
+        // Build associations between pairs of views
+        ClusterAssociationMap matchedClusterUV, matchedClusterVW, matchedClusterWU;
+        this->MatchClusters(cleanClustersU, cleanClustersV, matchedClusterUV);
+        this->MatchClusters(cleanClustersV, cleanClustersW, matchedClusterVW);
+        this->MatchClusters(cleanClustersW, cleanClustersU, matchedClusterWU);
+
+        // Match clusters between views to form particles
+        this->MatchThreeViews(matchedClusterUV, matchedClusterVW, matchedClusterWU, particleList);
+        this->MatchTwoViews(matchedClusterUV, matchedClusterVW, matchedClusterWU, particleList);
+    }
 
     // Build particles from associations
-    ParticleList particleList;
-    this->MatchThreeViews(matchedClusterUV, matchedClusterVW, matchedClusterWU, particleList);
-    this->MatchTwoViews(matchedClusterUV, matchedClusterVW, matchedClusterWU, particleList);
     this->BuildParticles(particleList);
 
     return STATUS_CODE_SUCCESS;
@@ -308,6 +322,9 @@ StatusCode CosmicRayBaseMatchingAlgorithm::ReadSettings(const TiXmlHandle xmlHan
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameV", m_inputClusterListNameV));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseClusterAttributeCache", m_useClusterAttributeCache));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -22,6 +22,11 @@ namespace lar_content
 class CosmicRayBaseMatchingAlgorithm : public pandora::Algorithm
 {
 protected:
+    /**
+     *  @brief  Default constructor
+     */
+    CosmicRayBaseMatchingAlgorithm();
+
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -157,6 +162,7 @@ private:
     std::string m_inputClusterListNameV; ///< The name of the view V cluster list
     std::string m_inputClusterListNameW; ///< The name of the view W cluster list
     std::string m_outputPfoListName;     ///< The name of the output PFO list
+    bool m_useClusterAttributeCache;     ///< Whether to cache derived cluster quantities whilst matching clusters between views
 };
 
 } // namespace lar_content
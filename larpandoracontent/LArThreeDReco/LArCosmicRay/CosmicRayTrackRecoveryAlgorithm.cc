@@ -50,20 +50,28 @@ StatusCode CosmicRayTrackRecoveryAlgorithm::Run()
     this->BuildSlidingFitResultMap(cleanClustersV, slidingFitResultMap);
     this->BuildSlidingFitResultMap(cleanClustersW, slidingFitResultMap);
 
+    // Index clean clusters by the drift span of their sliding fits
+    const DriftSpanIndex driftSpanIndexU(cleanClustersU, slidingFitResultMap);
+    const DriftSpanIndex driftSpanIndexV(cleanClustersV, slidingFitResultMap);
+    const DriftSpanIndex driftSpanIndexW(cleanClustersW, slidingFitResultMap);
+
     // Match clusters between pairs of views (using start/end information)
     ClusterAssociationMap matchedClustersUV, matchedClustersVW, matchedClustersWU;
-    this->MatchViews(cleanClustersU, cleanClustersV, slidingFitResultMap, matchedClustersUV);
-    this->MatchViews(cleanClustersV, cleanClustersW, slidingFitResultMap, matchedClustersVW);
-    this->MatchViews(cleanClustersW, cleanClustersU, slidingFitResultMap, matchedClustersWU);
+    this->MatchViews(driftSpanIndexU, driftSpanIndexV, slidingFitResultMap, matchedClustersUV);
+    this->MatchViews(driftSpanIndexV, driftSpanIndexW, slidingFitResultMap, matchedClustersVW);
+    this->MatchViews(driftSpanIndexW, driftSpanIndexU, slidingFitResultMap, matchedClustersWU);
 
     // Create candidate particles using one, two and three primary views
     ParticleList candidateParticles;
 
-    this->MatchThreeViews(cleanClustersU, cleanClustersV, cleanClustersW, matchedClustersUV, matchedClustersVW, matchedClustersWU, candidateParticles);
+    this->MatchThreeViews(driftSpanIndexU, driftSpanIndexV, driftSpanIndexW, slidingFitResultMap, matchedClustersUV, matchedClustersVW,
+        matchedClustersWU, candidateParticles);
 
-    this->MatchTwoViews(cleanClustersU, cleanClustersV, cleanClustersW, matchedClustersUV, matchedClustersVW, matchedClustersWU, candidateParticles);
+    this->MatchTwoViews(driftSpanIndexU, driftSpanIndexV, driftSpanIndexW, slidingFitResultMap, matchedClustersUV, matchedClustersVW,
+        matchedClustersWU, candidateParticles);
 
-    this->MatchOneView(cleanClustersU, cleanClustersV, cleanClustersW, matchedClustersUV, matchedClustersVW, matchedClustersWU, candidateParticles);
+    this->MatchOneView(driftSpanIndexU, driftSpanIndexV, driftSpanIndexW, slidingFitResultMap, matchedClustersUV, matchedClustersVW,
+        matchedClustersWU, candidateParticles);
 
     // Build particle flow objects from candidate particles
     this->BuildParticles(candidateParticles);
@@ -155,19 +163,22 @@ void CosmicRayTrackRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTrackRecoveryAlgorithm::MatchViews(const ClusterVector &clusterVector1, const ClusterVector &clusterVector2,
+void CosmicRayTrackRecoveryAlgorithm::MatchViews(const DriftSpanIndex &driftSpanIndex1, const DriftSpanIndex &driftSpanIndex2,
     const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
 {
+    const ClusterVector &clusterVector1(driftSpanIndex1.GetClusterVector());
+    const ClusterVector &clusterVector2(driftSpanIndex2.GetClusterVector());
+
     for (ClusterVector::const_iterator iter1 = clusterVector1.begin(), iterEnd1 = clusterVector1.end(); iter1 != iterEnd1; ++iter1)
-        this->MatchClusters(*iter1, clusterVector2, slidingFitResultMap, clusterAssociationMap);
+        this->MatchClusters(*iter1, driftSpanIndex2, slidingFitResultMap, clusterAssociationMap);
 
     for (ClusterVector::const_iterator iter2 = clusterVector2.begin(), iterEnd2 = clusterVector2.end(); iter2 != iterEnd2; ++iter2)
-        this->MatchClusters(*iter2, clusterVector1, slidingFitResultMap, clusterAssociationMap);
+        this->MatchClusters(*iter2, driftSpanIndex1, slidingFitResultMap, clusterAssociationMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCluster, const ClusterVector &targetClusters,
+void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCluster, const DriftSpanIndex &targetIndex,
     const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
 {
     // Match seed cluster to target clusters according to alignment in X position of start/end positions
@@ -193,6 +204,10 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
     float bestDisplacementOuter(m_clusterMaxDeltaX);
     float bestDisplacement(2.f * m_clusterMaxDeltaX);
 
+    // Target clusters without sufficient overlap in X can never match, so are not considered
+    ClusterVector targetClusters;
+    targetIndex.GetOverlappingClusters(ClusterVector(1, pSeedCluster), slidingFitResultMap, m_clusterMinOverlapX, targetClusters);
+
     for (ClusterVector::const_iterator tIter = targetClusters.begin(), tIterEnd = targetClusters.end(); tIter != tIterEnd; ++tIter)
     {
         const Cluster *const pTargetCluster = *tIter;
@@ -309,8 +324,9 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV,
-    const ClusterVector &clusterVectorW, const ClusterAssociationMap &matchedClustersUV, const ClusterAssociationMap &matchedClustersVW,
+void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const DriftSpanIndex &driftSpanIndexU, const DriftSpanIndex &driftSpanIndexV,
+    const DriftSpanIndex &driftSpanIndexW, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    const ClusterAssociationMap &matchedClustersUV, const ClusterAssociationMap &matchedClustersVW,
     const ClusterAssociationMap &matchedClustersWU, ParticleList &particleList) const
 {
     ClusterSet vetoList;
@@ -318,9 +334,9 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
 
     ParticleList newParticleList;
 
-    const ClusterVector &clusterVector1(clusterVectorU);
-    const ClusterVector &clusterVector2(clusterVectorV);
-    const ClusterVector &clusterVector3(clusterVectorW);
+    const ClusterVector &clusterVector1(driftSpanIndexU.GetClusterVector());
+    const DriftSpanIndex &driftSpanIndex2(driftSpanIndexV);
+    const DriftSpanIndex &driftSpanIndex3(driftSpanIndexW);
 
     const ClusterAssociationMap &matchedClusters12(matchedClustersUV);
     const ClusterAssociationMap &matchedClusters23(matchedClustersVW);
@@ -339,6 +355,10 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
         const ClusterAssociationMap::const_iterator iter121 = matchedClusters12.find(pCluster1);
         const ClusterList matchedClusters12_pCluster1(iter121 != matchedClusters12.end() ? iter121->second : ClusterList());
 
+        // ATTN Each pair of clusters in a particle must be associated, which requires sufficient overlap in X
+        ClusterVector clusterVector2;
+        driftSpanIndex2.GetOverlappingClusters(ClusterVector(1, pCluster1), slidingFitResultMap, m_clusterMinOverlapX, clusterVector2);
+
         for (ClusterVector::const_iterator iter2 = clusterVector2.begin(), iterEndV = clusterVector2.end(); iter2 != iterEndV; ++iter2)
         {
             const Cluster *const pCluster2 = *iter2;
@@ -352,6 +372,9 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
             const ClusterAssociationMap::const_iterator iter232 = matchedClusters23.find(pCluster2);
             const ClusterList matchedClusters23_pCluster2(iter232 != matchedClusters23.end() ? iter232->second : ClusterList());
 
+            ClusterVector clusterVector3;
+            driftSpanIndex3.GetOverlappingClusters(ClusterVector(1, pCluster2), slidingFitResultMap, m_clusterMinOverlapX, clusterVector3);
+
             for (ClusterVector::const_iterator iter3 = clusterVector3.begin(), iterEnd3 = clusterVector3.end(); iter3 != iterEnd3; ++iter3)
             {
                 const Cluster *const pCluster3 = *iter3;
@@ -409,8 +432,9 @@ void CosmicRayTrackRecoveryAlgorithm::MatchThreeViews(const ClusterVector &clust
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV,
-    const ClusterVector &clusterVectorW, const ClusterAssociationMap &matchedClustersUV, const ClusterAssociationMap &matchedClustersVW,
+void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const DriftSpanIndex &driftSpanIndexU, const DriftSpanIndex &driftSpanIndexV,
+    const DriftSpanIndex &driftSpanIndexW, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    const ClusterAssociationMap &matchedClustersUV, const ClusterAssociationMap &matchedClustersVW,
     const ClusterAssociationMap &matchedClustersWU, ParticleList &particleList) const
 {
     ClusterSet vetoList;
@@ -420,9 +444,10 @@ void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &cluster
 
     for (unsigned int iView = 0; iView < 3; ++iView)
     {
-        const ClusterVector &clusterVector1((0 == iView) ? clusterVectorU : (1 == iView) ? clusterVectorV : clusterVectorW);
-        const ClusterVector &clusterVector2((0 == iView) ? clusterVectorV : (1 == iView) ? clusterVectorW : clusterVectorU);
-        const ClusterVector &clusterVector3((0 == iView) ? clusterVectorW : (1 == iView) ? clusterVectorU : clusterVectorV);
+        const DriftSpanIndex &driftSpanIndex1((0 == iView) ? driftSpanIndexU : (1 == iView) ? driftSpanIndexV : driftSpanIndexW);
+        const DriftSpanIndex &driftSpanIndex2((0 == iView) ? driftSpanIndexV : (1 == iView) ? driftSpanIndexW : driftSpanIndexU);
+        const DriftSpanIndex &driftSpanIndex3((0 == iView) ? driftSpanIndexW : (1 == iView) ? driftSpanIndexU : driftSpanIndexV);
+        const ClusterVector &clusterVector1(driftSpanIndex1.GetClusterVector());
 
         const ClusterAssociationMap &matchedClusters12(((0 == iView) ? matchedClustersUV : (1 == iView) ? matchedClustersVW : matchedClustersWU));
         const ClusterAssociationMap &matchedClusters23(((0 == iView) ? matchedClustersVW : (1 == iView) ? matchedClustersWU : matchedClustersUV));
@@ -441,6 +466,10 @@ void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &cluster
             const ClusterAssociationMap::const_iterator iter121 = matchedClusters12.find(pCluster1);
             const ClusterList matchedClusters12_pCluster1(iter121 != matchedClusters12.end() ? iter121->second : ClusterList());
 
+            // ATTN The primary pair of clusters must be associated, which requires sufficient overlap in X
+            ClusterVector clusterVector2;
+            driftSpanIndex2.GetOverlappingClusters(ClusterVector(1, pCluster1), slidingFitResultMap, m_clusterMinOverlapX, clusterVector2);
+
             for (ClusterVector::const_iterator iter2 = clusterVector2.begin(), iterEnd2 = clusterVector2.end(); iter2 != iterEnd2; ++iter2)
             {
                 const Cluster *const pCluster2 = *iter2;
@@ -468,6 +497,11 @@ void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &cluster
                 newParticle.m_clusterList.push_back(pCluster1);
                 newParticle.m_clusterList.push_back(pCluster2);
 
+                // ATTN A broken cluster must be associated with one of the primary clusters, so requires sufficient overlap in X
+                ClusterVector clusterVector3;
+                const ClusterVector primaryClusters{pCluster1, pCluster2};
+                driftSpanIndex3.GetOverlappingClusters(primaryClusters, slidingFitResultMap, m_clusterMinOverlapX, clusterVector3);
+
                 for (ClusterVector::const_iterator iter3 = clusterVector3.begin(), iterEnd3 = clusterVector3.end(); iter3 != iterEnd3; ++iter3)
                 {
                     const Cluster *const pCluster3 = *iter3;
@@ -505,8 +539,9 @@ void CosmicRayTrackRecoveryAlgorithm::MatchTwoViews(const ClusterVector &cluster
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTrackRecoveryAlgorithm::MatchOneView(const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV,
-    const ClusterVector &clusterVectorW, const ClusterAssociationMap &matchedClustersUV, const ClusterAssociationMap &matchedClustersVW,
+void CosmicRayTrackRecoveryAlgorithm::MatchOneView(const DriftSpanIndex &driftSpanIndexU, const DriftSpanIndex &driftSpanIndexV,
+    const DriftSpanIndex &driftSpanIndexW, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    const ClusterAssociationMap &matchedClustersUV, const ClusterAssociationMap &matchedClustersVW,
     const ClusterAssociationMap &matchedClustersWU, ParticleList &particleList) const
 {
     ClusterSet vetoList;
@@ -516,9 +551,10 @@ void CosmicRayTrackRecoveryAlgorithm::MatchOneView(const ClusterVector &clusterV
 
     for (unsigned int iView = 0; iView < 3; ++iView)
     {
-        const ClusterVector &clusterVector1((0 == iView) ? clusterVectorU : (1 == iView) ? clusterVectorV : clusterVectorW);
-        const ClusterVector &clusterVector2((0 == iView) ? clusterVectorV : (1 == iView) ? clusterVectorW : clusterVectorU);
-        const ClusterVector &clusterVector3((0 == iView) ? clusterVectorW : (1 == iView) ? clusterVectorU : clusterVectorV);
+        const DriftSpanIndex &driftSpanIndex1((0 == iView) ? driftSpanIndexU : (1 == iView) ? driftSpanIndexV : driftSpanIndexW);
+        const DriftSpanIndex &driftSpanIndex2((0 == iView) ? driftSpanIndexV : (1 == iView) ? driftSpanIndexW : driftSpanIndexU);
+        const DriftSpanIndex &driftSpanIndex3((0 == iView) ? driftSpanIndexW : (1 == iView) ? driftSpanIndexU : driftSpanIndexV);
+        const ClusterVector &clusterVector1(driftSpanIndex1.GetClusterVector());
 
         const ClusterAssociationMap &matchedClusters12(((0 == iView) ? matchedClustersUV : (1 == iView) ? matchedClustersVW : matchedClustersWU));
         const ClusterAssociationMap &matchedClusters23(((0 == iView) ? matchedClustersVW : (1 == iView) ? matchedClustersWU : matchedClustersUV));
@@ -543,6 +579,11 @@ void CosmicRayTrackRecoveryAlgorithm::MatchOneView(const ClusterVector &clusterV
             Particle newParticle;
             newParticle.m_clusterList.push_back(pCluster1);
 
+            // ATTN Each broken cluster must be associated with the primary cluster, so requires sufficient overlap in X
+            ClusterVector clusterVector2, clusterVector3;
+            driftSpanIndex2.GetOverlappingClusters(ClusterVector(1, pCluster1), slidingFitResultMap, m_clusterMinOverlapX, clusterVector2);
+            driftSpanIndex3.GetOverlappingClusters(ClusterVector(1, pCluster1), slidingFitResultMap, m_clusterMinOverlapX, clusterVector3);
+
             for (ClusterVector::const_iterator iter2 = clusterVector2.begin(), iterEnd2 = clusterVector2.end(); iter2 != iterEnd2; ++iter2)
             {
                 const Cluster *const pCluster2 = *iter2;
@@ -725,6 +766,78 @@ void CosmicRayTrackRecoveryAlgorithm::MergeClusters(const ClusterList &inputClus
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CosmicRayTrackRecoveryAlgorithm::DriftSpanIndex::DriftSpanIndex(
+    const ClusterVector &clusterVector, const TwoDSlidingFitResultMap &slidingFitResultMap) :
+    m_clusterVector(clusterVector)
+{
+    for (unsigned int index = 0; index < m_clusterVector.size(); ++index)
+    {
+        m_driftSpans.push_back(DriftSpanIndex::GetDriftSpan(m_clusterVector.at(index), slidingFitResultMap));
+        m_minDriftIndex.emplace_back(m_driftSpans.back().first, index);
+    }
+
+    std::sort(m_minDriftIndex.begin(), m_minDriftIndex.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ClusterVector &CosmicRayTrackRecoveryAlgorithm::DriftSpanIndex::GetClusterVector() const
+{
+    return m_clusterVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CosmicRayTrackRecoveryAlgorithm::DriftSpanIndex::DriftSpan CosmicRayTrackRecoveryAlgorithm::DriftSpanIndex::GetDriftSpan(
+    const Cluster *const pCluster, const TwoDSlidingFitResultMap &slidingFitResultMap)
+{
+    TwoDSlidingFitResultMap::const_iterator fitIter = slidingFitResultMap.find(pCluster);
+
+    if (slidingFitResultMap.end() == fitIter)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    const CartesianVector &innerVertex(fitIter->second.GetGlobalMinLayerPosition());
+    const CartesianVector &outerVertex(fitIter->second.GetGlobalMaxLayerPosition());
+
+    return DriftSpan(std::min(innerVertex.GetX(), outerVertex.GetX()), std::max(innerVertex.GetX(), outerVertex.GetX()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float CosmicRayTrackRecoveryAlgorithm::DriftSpanIndex::GetOverlap(const DriftSpan &driftSpan1, const DriftSpan &driftSpan2)
+{
+    return (std::min(driftSpan1.second, driftSpan2.second) - std::max(driftSpan1.first, driftSpan2.first));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CosmicRayTrackRecoveryAlgorithm::DriftSpanIndex::GetOverlappingClusters(const ClusterVector &clusterVector,
+    const TwoDSlidingFitResultMap &slidingFitResultMap, const float minOverlap, ClusterVector &overlappingClusters) const
+{
+    UIntSet overlappingIndices;
+
+    for (const Cluster *const pCluster : clusterVector)
+    {
+        const DriftSpan driftSpan(DriftSpanIndex::GetDriftSpan(pCluster, slidingFitResultMap));
+
+        // The overlap cannot exceed the difference between this max drift coordinate and an indexed min drift coordinate
+        const MinDriftIndex::const_iterator endIter(std::partition_point(m_minDriftIndex.begin(), m_minDriftIndex.end(),
+            [&driftSpan, minOverlap](const MinDriftEntry &entry) { return !(driftSpan.second - entry.first < minOverlap); }));
+
+        for (MinDriftIndex::const_iterator iter = m_minDriftIndex.begin(); iter != endIter; ++iter)
+        {
+            if (!(DriftSpanIndex::GetOverlap(driftSpan, m_driftSpans.at(iter->second)) < minOverlap))
+                overlappingIndices.insert(iter->second);
+        }
+    }
+
+    for (const unsigned int index : overlappingIndices)
+        overlappingClusters.push_back(m_clusterVector.at(index));
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode CosmicRayTrackRecoveryAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
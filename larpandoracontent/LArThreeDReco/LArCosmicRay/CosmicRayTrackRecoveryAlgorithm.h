@@ -44,6 +44,69 @@ private:
     typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterAssociationMap;
     typedef std::set<unsigned int> UIntSet;
 
+    /**
+     *  @brief  DriftSpanIndex class, indexing the clusters in a view by the drift coordinate span of their sliding fits
+     */
+    class DriftSpanIndex
+    {
+    public:
+        typedef std::pair<float, float> DriftSpan; ///< The min and max drift coordinates of the sliding fit end positions
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  clusterVector the clusters in the view, which must outlive the index
+         *  @param  slidingFitResultMap the map of sliding linear fit results, which must contain every cluster
+         */
+        DriftSpanIndex(const pandora::ClusterVector &clusterVector, const TwoDSlidingFitResultMap &slidingFitResultMap);
+
+        /**
+         *  @brief  Get the indexed clusters
+         *
+         *  @return the indexed clusters, in their original order
+         */
+        const pandora::ClusterVector &GetClusterVector() const;
+
+        /**
+         *  @brief  Get the drift span of a cluster from its sliding fit
+         *
+         *  @param  pCluster the address of the cluster
+         *  @param  slidingFitResultMap the map of sliding linear fit results
+         *
+         *  @return the drift span
+         */
+        static DriftSpan GetDriftSpan(const pandora::Cluster *const pCluster, const TwoDSlidingFitResultMap &slidingFitResultMap);
+
+        /**
+         *  @brief  Get the overlap between two drift spans, as evaluated when matching clusters
+         *
+         *  @param  driftSpan1 the first drift span
+         *  @param  driftSpan2 the second drift span
+         *
+         *  @return the overlap, negative for disjoint spans
+         */
+        static float GetOverlap(const DriftSpan &driftSpan1, const DriftSpan &driftSpan2);
+
+        /**
+         *  @brief  Get the indexed clusters whose drift span overlaps the drift span of any of a list of clusters by at least a minimum
+         *
+         *  @param  clusterVector the clusters
+         *  @param  slidingFitResultMap the map of sliding linear fit results
+         *  @param  minOverlap the minimum overlap
+         *  @param  overlappingClusters to receive the overlapping clusters, in their original order
+         */
+        void GetOverlappingClusters(const pandora::ClusterVector &clusterVector, const TwoDSlidingFitResultMap &slidingFitResultMap,
+            const float minOverlap, pandora::ClusterVector &overlappingClusters) const;
+
+    private:
+        typedef std::pair<float, unsigned int> MinDriftEntry; ///< The min drift coordinate and position in the cluster vector
+        typedef std::vector<MinDriftEntry> MinDriftIndex;
+
+        const pandora::ClusterVector &m_clusterVector; ///< The indexed clusters
+        std::vector<DriftSpan> m_driftSpans;           ///< The drift span of each cluster, in cluster vector order
+        MinDriftIndex m_minDriftIndex;                 ///< The min drift coordinates and positions, in min drift coordinate order
+    };
+
     /**
      *  @brief Get a vector of available clusters
      *
@@ -71,69 +134,75 @@ private:
     /**
      *  @brief Match a pair of cluster vectors and populate the cluster association map
      *
-     *  @param clusterVector1 the input vector of clusters from the first view
-     *  @param clusterVector2 the input vector of clusters from the second view
+     *  @param driftSpanIndex1 the input index of clusters from the first view
+     *  @param driftSpanIndex2 the input index of clusters from the second view
      *  @param slidingFitResultMap the input map of sliding linear fit results
      *  @param clusterAssociationMap the output map of cluster associations
      */
-    void MatchViews(const pandora::ClusterVector &clusterVector1, const pandora::ClusterVector &clusterVector2,
+    void MatchViews(const DriftSpanIndex &driftSpanIndex1, const DriftSpanIndex &driftSpanIndex2,
         const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const;
 
     /**
      *  @brief Match a seed cluster with a list of target clusters and populate the cluster association map
      *
      *  @param pSeedCluster the input seed cluster
-     *  @param targetClusters the input list of target clusters
+     *  @param targetIndex the input index of target clusters
      *  @param slidingFitResultMap the input map of sliding linear fit results
      *  @param clusterAssociationMap the output map of cluster associations
      */
-    void MatchClusters(const pandora::Cluster *const pSeedCluster, const pandora::ClusterVector &targetClusters,
+    void MatchClusters(const pandora::Cluster *const pSeedCluster, const DriftSpanIndex &targetIndex,
         const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const;
 
     /**
      *  @brief  Create candidate particles using three primary clusters
      *
-     *  @param clusterVectorU input vector of clusters from the U view
-     *  @param clusterVectorV input vector of clusters from the V view
-     *  @param clusterVectorW input vector of clusters from the W view
+     *  @param driftSpanIndexU input index of clusters from the U view
+     *  @param driftSpanIndexV input index of clusters from the V view
+     *  @param driftSpanIndexW input index of clusters from the W view
+     *  @param slidingFitResultMap the input map of sliding linear fit results
      *  @param clusterAssociationMapUV map of cluster associations between the U and V views
      *  @param clusterAssociationMapVW map of cluster associations between the V and W views
      *  @param clusterAssociationMapWU map of cluster associations between the W and U views
      *  @param particleList the output list of candidate particles
      */
-    void MatchThreeViews(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
-        const pandora::ClusterVector &clusterVectorW, const ClusterAssociationMap &clusterAssociationMapUV,
-        const ClusterAssociationMap &clusterAssociationMapVW, const ClusterAssociationMap &clusterAssociationMapWU, ParticleList &particleList) const;
+    void MatchThreeViews(const DriftSpanIndex &driftSpanIndexU, const DriftSpanIndex &driftSpanIndexV,
+        const DriftSpanIndex &driftSpanIndexW, const TwoDSlidingFitResultMap &slidingFitResultMap,
+        const ClusterAssociationMap &clusterAssociationMapUV, const ClusterAssociationMap &clusterAssociationMapVW,
+        const ClusterAssociationMap &clusterAssociationMapWU, ParticleList &particleList) const;
 
     /**
      *  @brief  Create candidate particles using two primary clusters and one pair of broken clusters
      *
-     *  @param clusterVectorU input vector of clusters from the U view
-     *  @param clusterVectorV input vector of clusters from the V view
-     *  @param clusterVectorW input vector of clusters from the W view
+     *  @param driftSpanIndexU input index of clusters from the U view
+     *  @param driftSpanIndexV input index of clusters from the V view
+     *  @param driftSpanIndexW input index of clusters from the W view
+     *  @param slidingFitResultMap the input map of sliding linear fit results
      *  @param clusterAssociationMapUV map of cluster associations between the U and V views
      *  @param clusterAssociationMapVW map of cluster associations between the V and W views
      *  @param clusterAssociationMapWU map of cluster associations between the W and U views
      *  @param particleList the output list of candidate particles
      */
-    void MatchTwoViews(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
-        const pandora::ClusterVector &clusterVectorW, const ClusterAssociationMap &clusterAssociationMapUV,
-        const ClusterAssociationMap &clusterAssociationMapVW, const ClusterAssociationMap &clusterAssociationMapWU, ParticleList &particleList) const;
+    void MatchTwoViews(const DriftSpanIndex &driftSpanIndexU, const DriftSpanIndex &driftSpanIndexV,
+        const DriftSpanIndex &driftSpanIndexW, const TwoDSlidingFitResultMap &slidingFitResultMap,
+        const ClusterAssociationMap &clusterAssociationMapUV, const ClusterAssociationMap &clusterAssociationMapVW,
+        const ClusterAssociationMap &clusterAssociationMapWU, ParticleList &particleList) const;
 
     /**
      *  @brief  Create candidate particles using one primary cluster and one pair of broken clusters
      *
-     *  @param clusterVectorU input vector of clusters from the U view
-     *  @param clusterVectorV input vector of clusters from the V view
-     *  @param clusterVectorW input vector of clusters from the W view
+     *  @param driftSpanIndexU input index of clusters from the U view
+     *  @param driftSpanIndexV input index of clusters from the V view
+     *  @param driftSpanIndexW input index of clusters from the W view
+     *  @param slidingFitResultMap the input map of sliding linear fit results
      *  @param clusterAssociationMapUV map of cluster associations between the U and V views
      *  @param clusterAssociationMapVW map of cluster associations between the V and W views
      *  @param clusterAssociationMapWU map of cluster associations between the W and U views
      *  @param particleList the output list of candidate particles
      */
-    void MatchOneView(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
-        const pandora::ClusterVector &clusterVectorW, const ClusterAssociationMap &clusterAssociationMapUV,
-        const ClusterAssociationMap &clusterAssociationMapVW, const ClusterAssociationMap &clusterAssociationMapWU, ParticleList &particleList) const;
+    void MatchOneView(const DriftSpanIndex &driftSpanIndexU, const DriftSpanIndex &driftSpanIndexV,
+        const DriftSpanIndex &driftSpanIndexW, const TwoDSlidingFitResultMap &slidingFitResultMap,
+        const ClusterAssociationMap &clusterAssociationMapUV, const ClusterAssociationMap &clusterAssociationMapVW,
+        const ClusterAssociationMap &clusterAssociationMapWU, ParticleList &particleList) const;
 
     /**
      *  @brief Build the list of clusters already used to create particles
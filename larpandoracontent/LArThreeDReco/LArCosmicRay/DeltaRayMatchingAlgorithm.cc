@@ -101,21 +101,24 @@ void DeltaRayMatchingAlgorithm::InitializeNearbyClusterMap(const std::string &cl
         CaloHitList daughterHits;
         pCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
 
+        if (daughterHits.empty())
+            continue;
+
+        ClusterSet &nearbyClusterSet(nearbyClusters[pCluster]);
+
+        KDTreeBoxVector searchRegions;
+        searchRegions.reserve(daughterHits.size());
+
         for (const CaloHit *const pCaloHit : daughterHits)
-        {
-            KDTreeBox searchRegionHits = build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D);
+            searchRegions.push_back(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
 
-            HitKDNode2DList found;
-            kdTree.search(searchRegionHits, found);
+        std::vector<HitKDNode2DList> foundLists;
+        kdTree.search(searchRegions, foundLists);
 
+        for (const HitKDNode2DList &found : foundLists)
+        {
             for (const auto &hit : found)
-            {
-                ClusterList &nearbyClusterList(nearbyClusters[pCluster]);
-                const Cluster *const pNearbyCluster(hitToClusterMap.at(hit.data));
-
-                if (nearbyClusterList.end() == std::find(nearbyClusterList.begin(), nearbyClusterList.end(), pNearbyCluster))
-                    nearbyClusterList.push_back(pNearbyCluster);
-            }
+                (void)nearbyClusterSet.insert(hitToClusterMap.at(hit.data));
         }
     }
 }
@@ -191,6 +194,32 @@ void DeltaRayMatchingAlgorithm::GetClusters(const std::string &inputClusterListN
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DeltaRayMatchingAlgorithm::InitializeParentPfoIndex(ParentPfoIndex &parentPfoIndex) const
+{
+    PfoVector &pfoVector(parentPfoIndex.m_pfoVector);
+    this->GetTrackPfos(m_parentPfoListName, pfoVector);
+    this->GetAllPfos(m_daughterPfoListName, pfoVector);
+
+    for (unsigned int pfoIndex = 0; pfoIndex < pfoVector.size(); ++pfoIndex)
+    {
+        for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+        {
+            ClusterList pfoClusterList;
+            LArPfoHelper::GetClusters(pfoVector.at(pfoIndex), hitType, pfoClusterList);
+
+            for (const Cluster *const pPfoCluster : pfoClusterList)
+            {
+                std::vector<unsigned int> &pfoIndices(parentPfoIndex.m_clusterToPfoIndices[pPfoCluster]);
+
+                if (pfoIndices.empty() || (pfoIndices.back() != pfoIndex))
+                    pfoIndices.push_back(pfoIndex);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void DeltaRayMatchingAlgorithm::ThreeViewMatching(ClusterLengthMap &clusterLengthMap) const
 {
     ClusterVector clustersU, clustersV, clustersW;
@@ -198,9 +227,11 @@ void DeltaRayMatchingAlgorithm::ThreeViewMatching(ClusterLengthMap &clusterLengt
     this->GetClusters(m_inputClusterListNameV, clustersV);
     this->GetClusters(m_inputClusterListNameW, clustersW);
 
-    PfoLengthMap pfoLengthMap;
+    ParentPfoIndex parentPfoIndex;
+    this->InitializeParentPfoIndex(parentPfoIndex);
+
     ParticleList initialParticleList, finalParticleList;
-    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
+    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, parentPfoIndex, initialParticleList);
     this->SelectParticles(initialParticleList, clusterLengthMap, finalParticleList);
     this->CreateParticles(finalParticleList);
 }
@@ -214,11 +245,13 @@ void DeltaRayMatchingAlgorithm::TwoViewMatching(ClusterLengthMap &clusterLengthM
     this->GetClusters(m_inputClusterListNameV, clustersV);
     this->GetClusters(m_inputClusterListNameW, clustersW);
 
-    PfoLengthMap pfoLengthMap;
+    ParentPfoIndex parentPfoIndex;
+    this->InitializeParentPfoIndex(parentPfoIndex);
+
     ParticleList initialParticleList, finalParticleList;
-    this->TwoViewMatching(clustersU, clustersV, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->TwoViewMatching(clustersV, clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->TwoViewMatching(clustersW, clustersU, clusterLengthMap, pfoLengthMap, initialParticleList);
+    this->TwoViewMatching(clustersU, clustersV, clusterLengthMap, parentPfoIndex, initialParticleList);
+    this->TwoViewMatching(clustersV, clustersW, clusterLengthMap, parentPfoIndex, initialParticleList);
+    this->TwoViewMatching(clustersW, clustersU, clusterLengthMap, parentPfoIndex, initialParticleList);
     this->SelectParticles(initialParticleList, clusterLengthMap, finalParticleList);
     this->CreateParticles(finalParticleList);
 }
@@ -232,12 +265,14 @@ void DeltaRayMatchingAlgorithm::OneViewMatching(ClusterLengthMap &clusterLengthM
     this->GetClusters(m_inputClusterListNameV, clustersV);
     this->GetClusters(m_inputClusterListNameW, clustersW);
 
-    PfoLengthMap pfoLengthMap;
+    ParentPfoIndex parentPfoIndex;
+    this->InitializeParentPfoIndex(parentPfoIndex);
+
     ParticleList initialParticleList, finalParticleList;
-    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->OneViewMatching(clustersU, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->OneViewMatching(clustersV, clusterLengthMap, pfoLengthMap, initialParticleList);
-    this->OneViewMatching(clustersW, clusterLengthMap, pfoLengthMap, initialParticleList);
+    this->ThreeViewMatching(clustersU, clustersV, clustersW, clusterLengthMap, parentPfoIndex, initialParticleList);
+    this->OneViewMatching(clustersU, clusterLengthMap, parentPfoIndex, initialParticleList);
+    this->OneViewMatching(clustersV, clusterLengthMap, parentPfoIndex, initialParticleList);
+    this->OneViewMatching(clustersW, clusterLengthMap, parentPfoIndex, initialParticleList);
     this->SelectParticles(initialParticleList, clusterLengthMap, finalParticleList);
     this->CreateParticles(finalParticleList);
 }
@@ -245,7 +280,7 @@ void DeltaRayMatchingAlgorithm::OneViewMatching(ClusterLengthMap &clusterLengthM
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::ThreeViewMatching(const ClusterVector &clusters1, const ClusterVector &clusters2,
-    const ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const
+    const ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex, ParticleList &particleList) const
 {
     if (clusters1.empty() || clusters2.empty() || clusters3.empty())
         return;
@@ -269,7 +304,7 @@ void DeltaRayMatchingAlgorithm::ThreeViewMatching(const ClusterVector &clusters1
                     continue;
 
                 const ParticleFlowObject *pBestPfo = NULL;
-                this->FindBestParentPfo(pCluster1, pCluster2, pCluster3, clusterLengthMap, pfoLengthMap, pBestPfo);
+                this->FindBestParentPfo(pCluster1, pCluster2, pCluster3, clusterLengthMap, parentPfoIndex, pBestPfo);
 
                 // ATTN Need to record all matches when all three views are used
                 particleList.push_back(Particle(pCluster1, pCluster2, pCluster3, pBestPfo));
@@ -281,7 +316,7 @@ void DeltaRayMatchingAlgorithm::ThreeViewMatching(const ClusterVector &clusters1
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::TwoViewMatching(const ClusterVector &clusters1, const ClusterVector &clusters2,
-    ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const
+    ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex, ParticleList &particleList) const
 {
     if (clusters1.empty() || clusters2.empty())
         return;
@@ -300,7 +335,7 @@ void DeltaRayMatchingAlgorithm::TwoViewMatching(const ClusterVector &clusters1,
                 continue;
 
             const ParticleFlowObject *pBestPfo = NULL;
-            this->FindBestParentPfo(pCluster1, pCluster2, NULL, clusterLengthMap, pfoLengthMap, pBestPfo);
+            this->FindBestParentPfo(pCluster1, pCluster2, NULL, clusterLengthMap, parentPfoIndex, pBestPfo);
 
             if (NULL == pBestPfo)
                 continue;
@@ -313,7 +348,7 @@ void DeltaRayMatchingAlgorithm::TwoViewMatching(const ClusterVector &clusters1,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::OneViewMatching(
-    const ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const
+    const ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex, ParticleList &particleList) const
 {
     if (clusters.empty())
         return;
@@ -324,7 +359,7 @@ void DeltaRayMatchingAlgorithm::OneViewMatching(
             continue;
 
         const ParticleFlowObject *pBestPfo = NULL;
-        this->FindBestParentPfo(pCluster, NULL, NULL, clusterLengthMap, pfoLengthMap, pBestPfo);
+        this->FindBestParentPfo(pCluster, NULL, NULL, clusterLengthMap, parentPfoIndex, pBestPfo);
 
         if (NULL == pBestPfo)
             continue;
@@ -519,11 +554,10 @@ bool DeltaRayMatchingAlgorithm::AreClustersMatched(const Cluster *const pCluster
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DeltaRayMatchingAlgorithm::FindBestParentPfo(const Cluster *const pCluster1, const Cluster *const pCluster2,
-    const Cluster *const pCluster3, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, const ParticleFlowObject *&pBestPfo) const
+    const Cluster *const pCluster3, ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex,
+    const ParticleFlowObject *&pBestPfo) const
 {
-    PfoVector pfoVector;
-    this->GetTrackPfos(m_parentPfoListName, pfoVector);
-    this->GetAllPfos(m_daughterPfoListName, pfoVector);
+    const PfoVector &pfoVector(parentPfoIndex.m_pfoVector);
 
     if (pfoVector.empty())
         throw StatusCodeException(STATUS_CODE_FAILURE);
@@ -549,11 +583,36 @@ void DeltaRayMatchingAlgorithm::FindBestParentPfo(const Cluster *const pCluster1
         ++numViews;
     }
 
+    // ATTN Only pfos with a cluster near to each of the provided clusters can be selected, considered in their original order
+    UIntSet candidatePfoIndices;
+    bool isFirstCluster(true);
+
+    for (const Cluster *const pCluster : {pCluster1, pCluster2, pCluster3})
+    {
+        if (NULL == pCluster)
+            continue;
+
+        UIntSet nearbyPfoIndices;
+        this->GetNearbyPfoIndices(pCluster, parentPfoIndex, nearbyPfoIndices);
+
+        if (isFirstCluster)
+        {
+            candidatePfoIndices.swap(nearbyPfoIndices);
+            isFirstCluster = false;
+            continue;
+        }
+
+        for (UIntSet::iterator iter = candidatePfoIndices.begin(); iter != candidatePfoIndices.end();)
+            iter = nearbyPfoIndices.count(*iter) ? std::next(iter) : candidatePfoIndices.erase(iter);
+    }
+
     float bestDistanceSquared(static_cast<float>(numViews) * m_distanceForMatching * m_distanceForMatching);
 
-    for (const ParticleFlowObject *const pPfo : pfoVector)
+    for (const unsigned int pfoIndex : candidatePfoIndices)
     {
-        if (lengthSquared > this->GetLengthFromCache(pPfo, pfoLengthMap))
+        const ParticleFlowObject *const pPfo(pfoVector.at(pfoIndex));
+
+        if (lengthSquared > this->GetLengthFromCache(pPfo, parentPfoIndex.m_pfoLengthMap))
             continue;
 
         try
@@ -639,9 +698,10 @@ float DeltaRayMatchingAlgorithm::GetDistanceSquaredToPfo(const Cluster *const pC
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
     ClusterList comparisonList;
-    const ClusterToClustersMap &nearbyClusters((TPC_VIEW_U == hitType) ? m_nearbyClustersU : (TPC_VIEW_V == hitType) ? m_nearbyClustersV : m_nearbyClustersW);
+    const ClusterToClustersMap &nearbyClusters(this->GetNearbyClusterMap(hitType));
+    const ClusterToClustersMap::const_iterator nearbyIter(nearbyClusters.find(pCluster));
 
-    if (!nearbyClusters.count(pCluster))
+    if (nearbyClusters.end() == nearbyIter)
         return std::numeric_limits<float>::max();
 
     ClusterList pfoClusterList;
@@ -649,9 +709,7 @@ float DeltaRayMatchingAlgorithm::GetDistanceSquaredToPfo(const Cluster *const pC
 
     for (const Cluster *const pPfoCluster : pfoClusterList)
     {
-        const ClusterList &clusterList(nearbyClusters.at(pCluster));
-
-        if ((clusterList.end() != std::find(clusterList.begin(), clusterList.end(), pPfoCluster)) &&
+        if (nearbyIter->second.count(pPfoCluster) &&
             (comparisonList.end() == std::find(comparisonList.begin(), comparisonList.end(), pPfoCluster)))
         {
             comparisonList.push_back(pPfoCluster);
@@ -666,6 +724,36 @@ float DeltaRayMatchingAlgorithm::GetDistanceSquaredToPfo(const Cluster *const pC
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DeltaRayMatchingAlgorithm::GetNearbyPfoIndices(
+    const Cluster *const pCluster, const ParentPfoIndex &parentPfoIndex, UIntSet &pfoIndices) const
+{
+    const ClusterToClustersMap &nearbyClusters(this->GetNearbyClusterMap(LArClusterHelper::GetClusterHitType(pCluster)));
+    const ClusterToClustersMap::const_iterator nearbyIter(nearbyClusters.find(pCluster));
+
+    if (nearbyClusters.end() == nearbyIter)
+        return;
+
+    for (const Cluster *const pNearbyCluster : nearbyIter->second)
+    {
+        const ClusterToPfoIndicesMap::const_iterator pfoIter(parentPfoIndex.m_clusterToPfoIndices.find(pNearbyCluster));
+
+        if (parentPfoIndex.m_clusterToPfoIndices.end() != pfoIter)
+            pfoIndices.insert(pfoIter->second.begin(), pfoIter->second.end());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const DeltaRayMatchingAlgorithm::ClusterToClustersMap &DeltaRayMatchingAlgorithm::GetNearbyClusterMap(const HitType hitType) const
+{
+    if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    return ((TPC_VIEW_U == hitType) ? m_nearbyClustersU : (TPC_VIEW_V == hitType) ? m_nearbyClustersV : m_nearbyClustersW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void DeltaRayMatchingAlgorithm::CreateDaughterPfo(const ClusterList &clusterList, const ParticleFlowObject *const pParentPfo) const
 {
     const PfoList *pPfoList = NULL;
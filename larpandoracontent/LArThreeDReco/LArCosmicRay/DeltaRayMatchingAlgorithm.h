@@ -96,7 +96,7 @@ private:
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
-    typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterToClustersMap;
+    typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterSet> ClusterToClustersMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
 
     /**
@@ -144,6 +144,27 @@ private:
 
     typedef std::unordered_map<const pandora::Cluster *, float> ClusterLengthMap;
     typedef std::unordered_map<const pandora::ParticleFlowObject *, float> PfoLengthMap;
+    typedef std::unordered_map<const pandora::Cluster *, std::vector<unsigned int>> ClusterToPfoIndicesMap;
+    typedef std::set<unsigned int> UIntSet;
+
+    /**
+     *  @brief  ParentPfoIndex class, holding the candidate parent pfos for a single matching pass
+     */
+    class ParentPfoIndex
+    {
+    public:
+        pandora::PfoVector m_pfoVector;               ///< The candidate parent pfos, in the order in which they are considered
+        PfoLengthMap m_pfoLengthMap;                  ///< The pfo length map
+        ClusterToPfoIndicesMap m_clusterToPfoIndices; ///< Map from each pfo cluster to the positions of its pfos in the pfo vector
+    };
+
+    /**
+     *  @brief  Collect the candidate parent pfos, track-like parent pfos and all daughter pfos, and index them by their clusters.
+     *          Pfos are only modified at the end of each matching pass, so the index is valid for the duration of a pass.
+     *
+     *  @param  parentPfoIndex to receive the parent pfo index
+     */
+    void InitializeParentPfoIndex(ParentPfoIndex &parentPfoIndex) const;
 
     /**
      *  @brief  Match clusters using all three views
@@ -173,11 +194,12 @@ private:
      *  @param  clusters2 the list of clusters in the second view
      *  @param  clusters3 the list of clusters in the third view
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoIndex the parent pfo index
      *  @param  particleList the output list of particles
      */
     void ThreeViewMatching(const pandora::ClusterVector &clusters1, const pandora::ClusterVector &clusters2,
-        const pandora::ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const;
+        const pandora::ClusterVector &clusters3, ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex,
+        ParticleList &particleList) const;
 
     /**
      *  @brief  Match clusters using a pair of views
@@ -185,21 +207,21 @@ private:
      *  @param  clusters1 the list of clusters in the first view
      *  @param  clusters2 the list of clusters in the second view
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoIndex the parent pfo index
      *  @param  particleList the output list of particles
      */
     void TwoViewMatching(const pandora::ClusterVector &clusters1, const pandora::ClusterVector &clusters2,
-        ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, ParticleList &particleList) const;
+        ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex, ParticleList &particleList) const;
 
     /**
      *  @brief  Match clusters using a single view
      *
      *  @param  clusters the list of clusters in the provided view
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoIndex the parent pfo index
      *  @param  particleList the output list of particles
      */
-    void OneViewMatching(const pandora::ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap,
+    void OneViewMatching(const pandora::ClusterVector &clusters, ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex,
         ParticleList &particleList) const;
 
     /**
@@ -225,11 +247,11 @@ private:
      *  @param  pClusterV pointer to V view cluster
      *  @param  pClusterW pointer to W view cluster
      *  @param  clusterLengthMap the cluster length map
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoIndex the parent pfo index
      *  @param  pBestPfo to receive the address of the best Pfo
      */
     void FindBestParentPfo(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW,
-        ClusterLengthMap &clusterLengthMap, PfoLengthMap &pfoLengthMap, const pandora::ParticleFlowObject *&pBestPfo) const;
+        ClusterLengthMap &clusterLengthMap, ParentPfoIndex &parentPfoIndex, const pandora::ParticleFlowObject *&pBestPfo) const;
 
     /**
      *  @brief  Reduce number of length (squared) calculations by caching results when they are first obtained
@@ -245,7 +267,7 @@ private:
      *  @brief  Reduce number of length (squared) calculations by caching results when they are first obtained
      *
      *  @param  pPfo the pfo
-     *  @param  pfoLengthMap the pfo length map
+     *  @param  parentPfoIndex the parent pfo index
      *
      *  @return the length (squared)
      */
@@ -278,6 +300,25 @@ private:
      */
     float GetDistanceSquaredToPfo(const pandora::Cluster *const pCluster, const pandora::ParticleFlowObject *const pPfo) const;
 
+    /**
+     *  @brief  Get the positions, in the parent pfo index, of the pfos owning a cluster near to a provided cluster. Other pfos
+     *          are at distance std::numeric_limits<float>::max() from the cluster, so can never be selected as its parent.
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  parentPfoIndex the parent pfo index
+     *  @param  pfoIndices to receive the pfo positions
+     */
+    void GetNearbyPfoIndices(const pandora::Cluster *const pCluster, const ParentPfoIndex &parentPfoIndex, UIntSet &pfoIndices) const;
+
+    /**
+     *  @brief  Get the nearby clusters map for a specified hit type
+     *
+     *  @param  hitType the hit type
+     *
+     *  @return the nearby clusters map
+     */
+    const ClusterToClustersMap &GetNearbyClusterMap(const pandora::HitType hitType) const;
+
     /**
      *  @brief  Create a new Pfo from an input cluster list and set up a parent/daughter relationship
      *
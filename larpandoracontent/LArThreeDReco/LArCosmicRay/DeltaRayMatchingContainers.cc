@@ -108,13 +108,17 @@ void DeltaRayMatchingContainers::AddToClusterProximityMap(const Cluster *const p
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
+    KDTreeBoxVector searchRegions;
+    searchRegions.reserve(caloHitList.size());
+
     for (const CaloHit *const pCaloHit : caloHitList)
-    {
-        HitKDNode2DList found;
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
+        searchRegions.push_back(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
 
-        kdTree.search(searchRegionHits, found);
+    std::vector<HitKDNode2DList> foundLists;
+    kdTree.search(searchRegions, foundLists);
 
+    for (const HitKDNode2DList &found : foundLists)
+    {
         for (const auto &hit : found)
         {
             const Cluster *const pNearbyCluster(hitToClusterMap.at(hit.data));
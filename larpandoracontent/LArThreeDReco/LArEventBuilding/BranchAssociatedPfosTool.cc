@@ -38,6 +38,7 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    NeutrinoHierarchyAlgorithm::PfoPairSet rejectedPairs;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -66,11 +67,14 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
 
             for (const ParticleFlowObject *const pPfo : unassignedPfos)
             {
-                if (recentlyAssigned.count(pPfo))
+                if (recentlyAssigned.count(pPfo) || rejectedPairs.count(NeutrinoHierarchyAlgorithm::PfoPair(pParentPfo, pPfo)))
                     continue;
 
+                // ATTN Each pair is tested at most once, as the outcome depends only on properties fixed when the parent was assigned
+                rejectedPairs.insert(NeutrinoHierarchyAlgorithm::PfoPair(pParentPfo, pPfo));
+
                 PfoInfo *const pPfoInfo(pfoInfoMap.at(pPfo));
-                const LArPointingCluster pointingCluster(*(pPfoInfo->GetSlidingFitResult3D()));
+                const LArPointingCluster &pointingCluster(pPfoInfo->GetPointingCluster());
 
                 const float dNeutrinoVertex(std::min((pointingCluster.GetInnerVertex().GetPosition() - pNeutrinoVertex->GetPosition()).GetMagnitude(),
                     (pointingCluster.GetOuterVertex().GetPosition() - pNeutrinoVertex->GetPosition()).GetMagnitude()));
@@ -84,6 +88,13 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
                 if (parentIsTrack && (dParentVertex < m_trackBranchAdditionFraction * parentLength3D))
                     continue;
 
+                // Branch vertices near the parent cluster must also lie near the bounding box of the parent cluster
+                const float maxBoundingBoxDistance(1.01f * m_maxParentClusterDistance);
+
+                if ((pParentPfoInfo->GetBoundingBoxDistance(pointingCluster.GetInnerVertex().GetPosition()) > maxBoundingBoxDistance) &&
+                    (pParentPfoInfo->GetBoundingBoxDistance(pointingCluster.GetOuterVertex().GetPosition()) > maxBoundingBoxDistance))
+                    continue;
+
                 const float dInnerVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetInnerVertex().GetPosition(), pParentCluster3D));
                 const float dOuterVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetOuterVertex().GetPosition(), pParentCluster3D));
 
@@ -40,6 +40,15 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    // ATTN Any association requires the parent endpoint to lie within a bounded distance of the daughter vertex or daughter cluster
+    const float maxLongitudinalDistance(std::max(std::fabs(m_minVertexLongitudinalDistance), m_maxVertexLongitudinalDistance));
+    const float tanSqTheta(std::pow(std::tan(M_PI * m_vertexAngularAllowance / 180.f), 2.0));
+    const float maxVertexDistance(std::sqrt(maxLongitudinalDistance * maxLongitudinalDistance * (1.f + tanSqTheta) +
+                                            m_maxVertexTransverseDistance * m_maxVertexTransverseDistance));
+    const float maxCandidateDistance(1.01f * std::max(maxVertexDistance, 2.f * m_maxParentEndpointDistance));
+
+    // Outcomes for each parent and daughter pair do not change between iterations, so rejected pairs are not considered again
+    NeutrinoHierarchyAlgorithm::PfoPairSet rejectedPairs;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -57,7 +66,7 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
         for (const ParticleFlowObject *const pParentPfo : assignedPfos)
         {
             PfoInfo *const pParentPfoInfo(pfoInfoMap.at(pParentPfo));
-            const LArPointingCluster parentPointingCluster(*(pParentPfoInfo->GetSlidingFitResult3D()));
+            const LArPointingCluster &parentPointingCluster(pParentPfoInfo->GetPointingCluster());
 
             const LArPointingCluster::Vertex &parentEndpoint(
                 pParentPfoInfo->IsInnerLayerAssociated() ? parentPointingCluster.GetOuterVertex() : parentPointingCluster.GetInnerVertex());
@@ -68,12 +77,18 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
 
             for (const ParticleFlowObject *const pPfo : unassignedPfos)
             {
-                if (recentlyAssigned.count(pPfo))
+                if (recentlyAssigned.count(pPfo) || rejectedPairs.count(NeutrinoHierarchyAlgorithm::PfoPair(pParentPfo, pPfo)))
                     continue;
 
                 PfoInfo *const pPfoInfo(pfoInfoMap.at(pPfo));
 
-                const LArPointingCluster pointingCluster(*(pPfoInfo->GetSlidingFitResult3D()));
+                if (pPfoInfo->GetBoundingBoxDistance(parentEndpoint.GetPosition()) > maxCandidateDistance)
+                {
+                    rejectedPairs.insert(NeutrinoHierarchyAlgorithm::PfoPair(pParentPfo, pPfo));
+                    continue;
+                }
+
+                const LArPointingCluster &pointingCluster(pPfoInfo->GetPointingCluster());
                 const bool useInner((pointingCluster.GetInnerVertex().GetPosition() - parentEndpoint.GetPosition()).GetMagnitudeSquared() <
                                     (pointingCluster.GetOuterVertex().GetPosition() - parentEndpoint.GetPosition()).GetMagnitudeSquared());
 
@@ -93,6 +108,10 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
                     pPfoInfo->SetInnerLayerAssociation(useInner);
                     recentlyAssigned.insert(pPfoInfo->GetThisPfo());
                 }
+                else
+                {
+                    rejectedPairs.insert(NeutrinoHierarchyAlgorithm::PfoPair(pParentPfo, pPfo));
+                }
             }
         }
     }
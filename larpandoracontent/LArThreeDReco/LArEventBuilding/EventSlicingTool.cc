@@ -561,7 +561,7 @@ void EventSlicingTool::AssignRemainingHitsToSlices(
             if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
                 throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-            PointKDTree2D &kdTree((TPC_VIEW_U == hitType) ? kdTreeU : (TPC_VIEW_V == hitType) ? kdTreeV : kdTreeW);
+            const PointKDTree2D &kdTree((TPC_VIEW_U == hitType) ? kdTreeU : (TPC_VIEW_V == hitType) ? kdTreeV : kdTreeW);
             const PointKDNode2D *pBestResultPoint(this->MatchClusterToSlice(pCluster2D, kdTree));
 
             if (!pBestResultPoint)
@@ -664,7 +664,8 @@ void EventSlicingTool::GetKDTreeEntries3D(const ClusterToSliceIndexMap &clusterT
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const EventSlicingTool::PointKDNode2D *EventSlicingTool::MatchClusterToSlice(const Cluster *const pCluster2D, PointKDTree2D &kdTree) const
+const EventSlicingTool::PointKDNode2D *EventSlicingTool::MatchClusterToSlice(
+    const Cluster *const pCluster2D, const PointKDTree2D &kdTree) const
 {
     PointList clusterPointList;
     const PointKDNode2D *pBestResultPoint(nullptr);
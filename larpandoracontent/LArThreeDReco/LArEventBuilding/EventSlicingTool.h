@@ -259,7 +259,7 @@ private:
      *
      *  @return the nearest-neighbour point identified by the kd tree
      */
-    const PointKDNode2D *MatchClusterToSlice(const pandora::Cluster *const pCluster2D, PointKDTree2D &kdTree) const;
+    const PointKDNode2D *MatchClusterToSlice(const pandora::Cluster *const pCluster2D, const PointKDTree2D &kdTree) const;
 
     /**
      *  @brief  Sort points (use Z, followed by X, followed by Y)
@@ -339,7 +339,8 @@ NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const pandora::ParticleFlowObject *
     m_pThisPfo(pPfo),
     m_pCluster3D(nullptr),
     m_pVertex3D(nullptr),
-    m_pSlidingFitResult3D(nullptr),
+    m_minimumCoordinate(0.f, 0.f, 0.f),
+    m_maximumCoordinate(0.f, 0.f, 0.f),
     m_isNeutrinoVertexAssociated(false),
     m_isInnerLayerAssociated(false),
     m_pParentPfo(nullptr)
@@ -351,61 +352,37 @@ NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const pandora::ParticleFlowObject *
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
     m_pCluster3D = *(clusterList3D.begin());
-    m_pSlidingFitResult3D = new ThreeDSlidingFitResult(m_pCluster3D, halfWindowLayers, layerPitch);
+    m_pSlidingFitResult3D = std::make_shared<const ThreeDSlidingFitResult>(m_pCluster3D, halfWindowLayers, layerPitch);
 
     if (m_pSlidingFitResult3D->GetMinLayer() >= m_pSlidingFitResult3D->GetMaxLayer())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const PfoInfo &rhs) :
-    m_pThisPfo(rhs.m_pThisPfo),
-    m_pCluster3D(rhs.m_pCluster3D),
-    m_pVertex3D(rhs.m_pVertex3D),
-    m_pSlidingFitResult3D(nullptr),
-    m_isNeutrinoVertexAssociated(rhs.m_isNeutrinoVertexAssociated),
-    m_isInnerLayerAssociated(rhs.m_isInnerLayerAssociated),
-    m_pParentPfo(rhs.m_pParentPfo),
-    m_daughterPfoList(rhs.m_daughterPfoList)
-{
-    if (!rhs.m_pSlidingFitResult3D)
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    m_pSlidingFitResult3D = new ThreeDSlidingFitResult(m_pCluster3D, rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerFitHalfWindow(),
-        rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerPitch());
-}
+    m_pPointingCluster = std::make_shared<const LArPointingCluster>(*m_pSlidingFitResult3D);
 
-//------------------------------------------------------------------------------------------------------------------------------------------
+    // ATTN Fitted endpoints can lie slightly beyond the hits, so the bounding box encloses both
+    LArClusterHelper::GetClusterBoundingBox(m_pCluster3D, m_minimumCoordinate, m_maximumCoordinate);
 
-NeutrinoHierarchyAlgorithm::PfoInfo &NeutrinoHierarchyAlgorithm::PfoInfo::operator=(const PfoInfo &rhs)
-{
-    if (this != &rhs)
+    for (const LArPointingCluster::Vertex *const pVertex : {&m_pPointingCluster->GetInnerVertex(), &m_pPointingCluster->GetOuterVertex()})
     {
-        if (!rhs.m_pSlidingFitResult3D)
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-
-        m_pThisPfo = rhs.m_pThisPfo;
-        m_pCluster3D = rhs.m_pCluster3D;
-        m_pVertex3D = rhs.m_pVertex3D;
-        m_isNeutrinoVertexAssociated = rhs.m_isNeutrinoVertexAssociated;
-        m_isInnerLayerAssociated = rhs.m_isInnerLayerAssociated;
-        m_pParentPfo = rhs.m_pParentPfo;
-        m_daughterPfoList = rhs.m_daughterPfoList;
-
-        delete m_pSlidingFitResult3D;
-        m_pSlidingFitResult3D = new ThreeDSlidingFitResult(m_pCluster3D, rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerFitHalfWindow(),
-            rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerPitch());
-    }
+        const CartesianVector &position(pVertex->GetPosition());
+        const CartesianVector &minimum(m_minimumCoordinate), &maximum(m_maximumCoordinate);
 
-    return *this;
+        m_minimumCoordinate = CartesianVector(
+            std::min(minimum.GetX(), position.GetX()), std::min(minimum.GetY(), position.GetY()), std::min(minimum.GetZ(), position.GetZ()));
+        m_maximumCoordinate = CartesianVector(
+            std::max(maximum.GetX(), position.GetX()), std::max(maximum.GetY(), position.GetY()), std::max(maximum.GetZ(), position.GetZ()));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-NeutrinoHierarchyAlgorithm::PfoInfo::~PfoInfo()
+float NeutrinoHierarchyAlgorithm::PfoInfo::GetBoundingBoxDistance(const CartesianVector &position) const
 {
-    delete m_pSlidingFitResult3D;
+    const float dx(std::max(0.f, std::max(m_minimumCoordinate.GetX() - position.GetX(), position.GetX() - m_maximumCoordinate.GetX())));
+    const float dy(std::max(0.f, std::max(m_minimumCoordinate.GetY() - position.GetY(), position.GetY() - m_maximumCoordinate.GetY())));
+    const float dz(std::max(0.f, std::max(m_minimumCoordinate.GetZ() - position.GetZ(), position.GetZ() - m_maximumCoordinate.GetZ())));
+
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,8 +10,11 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include <memory>
+#include <set>
 #include <unordered_map>
 
 namespace lar_content
@@ -47,25 +50,6 @@ public:
          */
         PfoInfo(const pandora::ParticleFlowObject *const pPfo, const unsigned int halfWindowLayers, const float layerPitch);
 
-        /**
-         *  @brief  Copy constructor
-         *
-         *  @param  rhs the pfo info to copy
-         */
-        PfoInfo(const PfoInfo &rhs);
-
-        /**
-         *  @brief  Assignment operator
-         *
-         *  @param  rhs the pfo info to assign
-         */
-        PfoInfo &operator=(const PfoInfo &rhs);
-
-        /**
-         *  @brief  Destructor
-         */
-        ~PfoInfo();
-
         /**
          *  @brief  Get the address of the pfo
          *
@@ -87,6 +71,22 @@ public:
          */
         const ThreeDSlidingFitResult *GetSlidingFitResult3D() const;
 
+        /**
+         *  @brief  Get the pointing cluster built from the three dimensional sliding fit result
+         *
+         *  @return the pointing cluster
+         */
+        const LArPointingCluster &GetPointingCluster() const;
+
+        /**
+         *  @brief  Get the distance from a position to the bounding box enclosing the three dimensional cluster and its fitted endpoints
+         *
+         *  @param  position the position
+         *
+         *  @return the distance, zero if the position lies within the bounding box
+         */
+        float GetBoundingBoxDistance(const pandora::CartesianVector &position) const;
+
         /**
          *  @brief  Whether the pfo is associated with the neutrino vertex
          *
@@ -156,10 +156,16 @@ public:
         void RemoveDaughterPfo(const pandora::ParticleFlowObject *const pDaughterPfo);
 
     private:
+        typedef std::shared_ptr<const ThreeDSlidingFitResult> SlidingFitResultPtr;
+        typedef std::shared_ptr<const LArPointingCluster> PointingClusterPtr;
+
         const pandora::ParticleFlowObject *m_pThisPfo; ///< The address of the pfo
         const pandora::Cluster *m_pCluster3D;          ///< The address of the three dimensional cluster
         const pandora::Vertex *m_pVertex3D;            ///< The address of the three dimensional vertex
-        ThreeDSlidingFitResult *m_pSlidingFitResult3D; ///< The three dimensional sliding fit result
+        SlidingFitResultPtr m_pSlidingFitResult3D;     ///< The three dimensional sliding fit result, shared between copies
+        PointingClusterPtr m_pPointingCluster;         ///< The pointing cluster, shared between copies
+        pandora::CartesianVector m_minimumCoordinate;  ///< The minimum coordinates of the bounding box
+        pandora::CartesianVector m_maximumCoordinate;  ///< The maximum coordinates of the bounding box
 
         bool m_isNeutrinoVertexAssociated; ///< Whether the pfo is associated with the neutrino vertex
         bool m_isInnerLayerAssociated;     ///< If associated, whether association to parent (vtx or pfo) is at sliding fit inner layer
@@ -168,6 +174,8 @@ public:
     };
 
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoInfo *> PfoInfoMap;
+    typedef std::pair<const pandora::ParticleFlowObject *, const pandora::ParticleFlowObject *> PfoPair;
+    typedef std::set<PfoPair> PfoPairSet;
 
     /**
      *  @brief  Query the pfo info map and separate/extract pfos currently either acting as parents or associated with the neutrino vertex
@@ -283,7 +291,14 @@ inline const pandora::Cluster *NeutrinoHierarchyAlgorithm::PfoInfo::GetCluster3D
 
 inline const ThreeDSlidingFitResult *NeutrinoHierarchyAlgorithm::PfoInfo::GetSlidingFitResult3D() const
 {
-    return m_pSlidingFitResult3D;
+    return m_pSlidingFitResult3D.get();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArPointingCluster &NeutrinoHierarchyAlgorithm::PfoInfo::GetPointingCluster() const
+{
+    return *m_pPointingCluster;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
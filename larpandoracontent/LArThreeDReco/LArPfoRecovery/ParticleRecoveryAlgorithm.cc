@@ -51,10 +51,17 @@ StatusCode ParticleRecoveryAlgorithm::Run()
     this->SelectInputClusters(inputClusterListV, selectedClusterListV);
     this->SelectInputClusters(inputClusterListW, selectedClusterListW);
 
+    TwoDSlidingFitResultMap slidingFitResultMap;
+    ClusterExtentVector extentVectorU, extentVectorV, extentVectorW;
+    this->GetClusterExtents(selectedClusterListU, slidingFitResultMap, extentVectorU);
+    this->GetClusterExtents(selectedClusterListV, slidingFitResultMap, extentVectorV);
+    this->GetClusterExtents(selectedClusterListW, slidingFitResultMap, extentVectorW);
+    this->CalculateEffectiveBounds(extentVectorU, extentVectorV, extentVectorW);
+
     SimpleOverlapTensor overlapTensor;
-    this->FindOverlaps(selectedClusterListU, selectedClusterListV, overlapTensor);
-    this->FindOverlaps(selectedClusterListV, selectedClusterListW, overlapTensor);
-    this->FindOverlaps(selectedClusterListW, selectedClusterListU, overlapTensor);
+    this->FindOverlaps(extentVectorU, extentVectorV, overlapTensor);
+    this->FindOverlaps(extentVectorV, extentVectorW, overlapTensor);
+    this->FindOverlaps(extentVectorW, extentVectorU, overlapTensor);
     this->ExamineTensor(overlapTensor);
 
     return STATUS_CODE_SUCCESS;
@@ -185,43 +192,226 @@ void ParticleRecoveryAlgorithm::VertexClusterSelection(const ClusterList &inputC
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ParticleRecoveryAlgorithm::FindOverlaps(const ClusterList &clusterList1, const ClusterList &clusterList2, SimpleOverlapTensor &overlapTensor) const
+void ParticleRecoveryAlgorithm::GetClusterExtents(
+    const ClusterList &clusterList, TwoDSlidingFitResultMap &slidingFitResultMap, ClusterExtentVector &extentVector) const
 {
-    for (ClusterList::const_iterator iter1 = clusterList1.begin(), iter1End = clusterList1.end(); iter1 != iter1End; ++iter1)
+    const bool checkGaps(m_checkGaps && !PandoraContentApi::GetGeometry(*this)->GetDetectorGapList().empty());
+    const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+
+    for (const Cluster *const pCluster : clusterList)
     {
-        for (ClusterList::const_iterator iter2 = clusterList2.begin(), iter2End = clusterList2.end(); iter2 != iter2End; ++iter2)
+        ClusterExtent clusterExtent(pCluster, extentVector.size());
+
+        if (checkGaps)
         {
-            if (this->IsOverlap(*iter1, *iter2))
-                overlapTensor.AddAssociation(*iter1, *iter2);
+            try
+            {
+                const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
+                const TwoDSlidingFitResultMap::const_iterator fitIter(
+                    slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).first);
+                clusterExtent.m_pSlidingFitResult = &(fitIter->second);
+            }
+            catch (StatusCodeException &)
+            {
+            }
         }
+
+        extentVector.push_back(clusterExtent);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool ParticleRecoveryAlgorithm::IsOverlap(const Cluster *const pCluster1, const Cluster *const pCluster2) const
+void ParticleRecoveryAlgorithm::CalculateEffectiveBounds(
+    ClusterExtentVector &extentVectorU, ClusterExtentVector &extentVectorV, ClusterExtentVector &extentVectorW) const
 {
-    if (LArClusterHelper::GetClusterHitType(pCluster1) == LArClusterHelper::GetClusterHitType(pCluster2))
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    float xMin(std::numeric_limits<float>::max()), xMax(-std::numeric_limits<float>::max());
 
-    if ((0 == pCluster1->GetNCaloHits()) || (0 == pCluster2->GetNCaloHits()))
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    for (const ClusterExtentVector *const pExtentVector : {&extentVectorU, &extentVectorV, &extentVectorW})
+    {
+        for (const ClusterExtent &clusterExtent : *pExtentVector)
+        {
+            xMin = std::min(xMin, clusterExtent.m_xMin);
+            xMax = std::max(xMax, clusterExtent.m_xMax);
+        }
+    }
 
-    float xMin1(0.f), xMax1(0.f), xMin2(0.f), xMax2(0.f);
-    pCluster1->GetClusterSpanX(xMin1, xMax1);
-    pCluster2->GetClusterSpanX(xMin2, xMax2);
+    for (ClusterExtentVector *const pExtentVector : {&extentVectorU, &extentVectorV, &extentVectorW})
+    {
+        for (ClusterExtent &clusterExtent : *pExtentVector)
+            this->CalculateEffectiveBounds(xMin, xMax, clusterExtent);
+    }
+}
 
-    const float xSpan1(xMax1 - xMin1), xSpan2(xMax2 - xMin2);
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParticleRecoveryAlgorithm::CalculateEffectiveBounds(const float xMin, const float xMax, ClusterExtent &clusterExtent) const
+{
+    clusterExtent.m_xLow = clusterExtent.m_xMin;
+    clusterExtent.m_xHigh = clusterExtent.m_xMax;
+
+    if (!clusterExtent.m_pSlidingFitResult)
+        return;
+
+    // ATTN Effective spans extend across the same sampling points in gaps, but are limited to the x range of each pair of clusters,
+    // with the final sampling point clamped to the edge of that range. Walking the full x range, then padding by one step, bounds all.
+    const TwoDSlidingFitResult &slidingFitResult(*clusterExtent.m_pSlidingFitResult);
+    const int nSamplingPointsLeft(1 + static_cast<int>((clusterExtent.m_xMin - xMin) / m_sampleStepSize));
+    const int nSamplingPointsRight(1 + static_cast<int>((xMax - clusterExtent.m_xMax) / m_sampleStepSize));
+
+    for (int iSample = 1; iSample <= nSamplingPointsLeft; ++iSample)
+    {
+        const float xSample(std::max(xMin, clusterExtent.m_xMin - static_cast<float>(iSample) * m_sampleStepSize));
+
+        if (!this->IsXSamplingPointInGap(xSample, slidingFitResult))
+            break;
+
+        clusterExtent.m_xLow = xSample;
+    }
+
+    for (int iSample = 1; iSample <= nSamplingPointsRight; ++iSample)
+    {
+        const float xSample(std::min(xMax, clusterExtent.m_xMax + static_cast<float>(iSample) * m_sampleStepSize));
+
+        if (!this->IsXSamplingPointInGap(xSample, slidingFitResult))
+            break;
+
+        clusterExtent.m_xHigh = xSample;
+    }
+
+    clusterExtent.m_xLow -= m_sampleStepSize;
+    clusterExtent.m_xHigh += m_sampleStepSize;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParticleRecoveryAlgorithm::IsXSamplingPointInGap(const float xSample, const TwoDSlidingFitResult &slidingFitResult) const
+{
+    try
+    {
+        return LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult, m_sampleStepSize);
+    }
+    catch (StatusCodeException &)
+    {
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParticleRecoveryAlgorithm::FindOverlaps(
+    const ClusterExtentVector &extentVector1, const ClusterExtentVector &extentVector2, SimpleOverlapTensor &overlapTensor) const
+{
+    if (extentVector1.empty() || extentVector2.empty())
+        return;
+
+    // ATTN Only candidate pairs are compared, so check every cluster here, as though all pairs of clusters were compared
+    for (const ClusterExtentVector *const pExtentVector : {&extentVector1, &extentVector2})
+    {
+        for (const ClusterExtent &clusterExtent : *pExtentVector)
+        {
+            if (0 == clusterExtent.m_pCluster->GetNCaloHits())
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            if ((clusterExtent.m_xMax - clusterExtent.m_xMin) < std::numeric_limits<float>::epsilon())
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        }
+    }
+
+    IndexPairVector candidatePairs;
+
+    if (m_minXOverlapFraction > 0.f)
+    {
+        this->GetCandidatePairs(extentVector1, extentVector2, candidatePairs);
+    }
+    else
+    {
+        for (unsigned int index1 = 0; index1 < extentVector1.size(); ++index1)
+        {
+            for (unsigned int index2 = 0; index2 < extentVector2.size(); ++index2)
+                candidatePairs.emplace_back(index1, index2);
+        }
+    }
+
+    // ATTN Add associations in cluster list order, so that the overlap tensor is independent of the sweep order
+    std::sort(candidatePairs.begin(), candidatePairs.end());
+
+    for (const IndexPair &indexPair : candidatePairs)
+    {
+        const ClusterExtent &clusterExtent1(extentVector1.at(indexPair.first));
+        const ClusterExtent &clusterExtent2(extentVector2.at(indexPair.second));
+
+        if (this->IsOverlap(clusterExtent1, clusterExtent2))
+            overlapTensor.AddAssociation(clusterExtent1.m_pCluster, clusterExtent2.m_pCluster);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParticleRecoveryAlgorithm::GetCandidatePairs(
+    const ClusterExtentVector &extentVector1, const ClusterExtentVector &extentVector2, IndexPairVector &candidatePairs) const
+{
+    typedef std::pair<const ClusterExtent *, bool> SweepElement;
+    typedef std::vector<SweepElement> SweepElementVector;
+
+    SweepElementVector sweepElements;
+
+    for (const ClusterExtent &clusterExtent : extentVector1)
+        sweepElements.emplace_back(&clusterExtent, true);
+
+    for (const ClusterExtent &clusterExtent : extentVector2)
+        sweepElements.emplace_back(&clusterExtent, false);
+
+    std::sort(sweepElements.begin(), sweepElements.end(),
+        [](const SweepElement &lhs, const SweepElement &rhs) { return (lhs.first->m_xLow < rhs.first->m_xLow); });
 
-    if ((xSpan1 < std::numeric_limits<float>::epsilon()) || (xSpan2 < std::numeric_limits<float>::epsilon()))
+    // Each extent is paired with the extents from the other list that are still active when its lower bound is reached
+    std::vector<const ClusterExtent *> activeExtents1, activeExtents2;
+
+    for (const SweepElement &sweepElement : sweepElements)
+    {
+        const ClusterExtent *const pClusterExtent(sweepElement.first);
+        const bool isFirst(sweepElement.second);
+        std::vector<const ClusterExtent *> &otherActiveExtents(isFirst ? activeExtents2 : activeExtents1);
+
+        otherActiveExtents.erase(std::remove_if(otherActiveExtents.begin(), otherActiveExtents.end(),
+                                     [pClusterExtent](const ClusterExtent *const pOtherExtent)
+                                     { return (pOtherExtent->m_xHigh < pClusterExtent->m_xLow); }),
+            otherActiveExtents.end());
+
+        for (const ClusterExtent *const pOtherExtent : otherActiveExtents)
+        {
+            if (isFirst)
+            {
+                candidatePairs.emplace_back(pClusterExtent->m_index, pOtherExtent->m_index);
+            }
+            else
+            {
+                candidatePairs.emplace_back(pOtherExtent->m_index, pClusterExtent->m_index);
+            }
+        }
+
+        (isFirst ? activeExtents1 : activeExtents2).push_back(pClusterExtent);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParticleRecoveryAlgorithm::IsOverlap(const ClusterExtent &clusterExtent1, const ClusterExtent &clusterExtent2) const
+{
+    if (LArClusterHelper::GetClusterHitType(clusterExtent1.m_pCluster) == LArClusterHelper::GetClusterHitType(clusterExtent2.m_pCluster))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    const float xMin1(clusterExtent1.m_xMin), xMax1(clusterExtent1.m_xMax), xMin2(clusterExtent2.m_xMin), xMax2(clusterExtent2.m_xMax);
+    const float xSpan1(xMax1 - xMin1), xSpan2(xMax2 - xMin2);
+
     const float xOverlap(std::min(xMax1, xMax2) - std::max(xMin1, xMin2));
 
     float xOverlapFraction1(xOverlap / xSpan1), xOverlapFraction2(xOverlap / xSpan2);
 
     if (m_checkGaps)
-        this->CalculateEffectiveOverlapFractions(pCluster1, xMin1, xMax1, pCluster2, xMin2, xMax2, xOverlapFraction1, xOverlapFraction2);
+        this->CalculateEffectiveOverlapFractions(clusterExtent1, clusterExtent2, xOverlapFraction1, xOverlapFraction2);
 
     if ((xOverlapFraction1 < m_minXOverlapFraction) || (xOverlapFraction2 < m_minXOverlapFraction))
         return false;
@@ -231,18 +421,22 @@ bool ParticleRecoveryAlgorithm::IsOverlap(const Cluster *const pCluster1, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ParticleRecoveryAlgorithm::CalculateEffectiveOverlapFractions(const Cluster *const pCluster1, const float xMin1, const float xMax1,
-    const Cluster *const pCluster2, const float xMin2, const float xMax2, float &xOverlapFraction1, float &xOverlapFraction2) const
+void ParticleRecoveryAlgorithm::CalculateEffectiveOverlapFractions(
+    const ClusterExtent &clusterExtent1, const ClusterExtent &clusterExtent2, float &xOverlapFraction1, float &xOverlapFraction2) const
 {
     if (PandoraContentApi::GetGeometry(*this)->GetDetectorGapList().empty())
         return;
 
+    const float xMin1(clusterExtent1.m_xMin), xMax1(clusterExtent1.m_xMax), xMin2(clusterExtent2.m_xMin), xMax2(clusterExtent2.m_xMax);
     const float xMin(std::min(xMin1, xMin2));
     const float xMax(std::max(xMax1, xMax2));
     float xMinEff1(xMin1), xMaxEff1(xMax1), xMinEff2(xMin2), xMaxEff2(xMax2);
 
-    this->CalculateEffectiveSpan(pCluster1, xMin, xMax, xMinEff1, xMaxEff1);
-    this->CalculateEffectiveSpan(pCluster2, xMin, xMax, xMinEff2, xMaxEff2);
+    if (clusterExtent1.m_pSlidingFitResult)
+        this->CalculateEffectiveSpan(*clusterExtent1.m_pSlidingFitResult, xMin, xMax, xMinEff1, xMaxEff1);
+
+    if (clusterExtent2.m_pSlidingFitResult)
+        this->CalculateEffectiveSpan(*clusterExtent2.m_pSlidingFitResult, xMin, xMax, xMinEff2, xMaxEff2);
 
     const float effectiveXSpan1(xMaxEff1 - xMinEff1), effectiveXSpan2(xMaxEff2 - xMinEff2);
     const float effectiveXOverlapSpan(std::min(xMaxEff1, xMaxEff2) - std::max(xMinEff1, xMinEff2));
@@ -257,15 +451,11 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveOverlapFractions(const Cluster
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(
-    const pandora::Cluster *const pCluster, const float xMin, const float xMax, float &xMinEff, float &xMaxEff) const
+    const TwoDSlidingFitResult &slidingFitResult, const float xMin, const float xMax, float &xMinEff, float &xMaxEff) const
 {
-    // TODO cache sliding linear fit results and optimise protection against exceptions from TwoDSlidingFitResult and IsXSamplingPointInGap
+    // TODO optimise protection against exceptions from IsXSamplingPointInGap
     try
     {
-        const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
-
         const int nSamplingPointsLeft(1 + static_cast<int>((xMinEff - xMin) / m_sampleStepSize));
         const int nSamplingPointsRight(1 + static_cast<int>((xMax - xMaxEff) / m_sampleStepSize));
         float dxMin(0.f), dxMax(0.f);
@@ -408,6 +598,23 @@ void ParticleRecoveryAlgorithm::CreateTrackParticle(const ClusterList &clusterLi
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ParticleRecoveryAlgorithm::ClusterExtent::ClusterExtent(const Cluster *const pCluster, const unsigned int index) :
+    m_pCluster(pCluster),
+    m_index(index),
+    m_xMin(0.f),
+    m_xMax(0.f),
+    m_xLow(0.f),
+    m_xHigh(0.f),
+    m_pSlidingFitResult(NULL)
+{
+    pCluster->GetClusterSpanX(m_xMin, m_xMax);
+    m_xLow = m_xMin;
+    m_xHigh = m_xMax;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ParticleRecoveryAlgorithm::SimpleOverlapTensor::AddAssociation(const Cluster *const pCluster1, const Cluster *const pCluster2)
 {
     const HitType hitType1(LArClusterHelper::GetClusterHitType(pCluster1));
@@ -10,6 +10,8 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -69,6 +71,33 @@ private:
         ClusterNavigationMap m_clusterNavigationMapWU; ///< The cluster navigation map W->U
     };
 
+    /**
+     *  @brief  ClusterExtent class, caching the x extent of a cluster for the overlap search
+     */
+    class ClusterExtent
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         *  @param  index the position of the cluster in its input cluster list
+         */
+        ClusterExtent(const pandora::Cluster *const pCluster, const unsigned int index);
+
+        const pandora::Cluster *m_pCluster;              ///< Address of the cluster
+        unsigned int m_index;                            ///< The position of the cluster in its input cluster list
+        float m_xMin;                                    ///< The min x value of the cluster
+        float m_xMax;                                    ///< The max x value of the cluster
+        float m_xLow;                                    ///< Lower bound on the effective min x value, including adjacent gaps
+        float m_xHigh;                                   ///< Upper bound on the effective max x value, including adjacent gaps
+        const TwoDSlidingFitResult *m_pSlidingFitResult; ///< Address of the sliding fit result used to check for gaps, if any
+    };
+
+    typedef std::vector<ClusterExtent> ClusterExtentVector;
+    typedef std::pair<unsigned int, unsigned int> IndexPair;
+    typedef std::vector<IndexPair> IndexPairVector;
+
     pandora::StatusCode Run();
 
     /**
@@ -104,48 +133,95 @@ private:
      */
     void VertexClusterSelection(const pandora::ClusterList &inputClusterList, pandora::ClusterList &selectedClusterList) const;
 
+    /**
+     *  @brief  Get the x extents of a list of clusters, with the sliding fit results required to check for gaps
+     *
+     *  @param  clusterList the cluster list
+     *  @param  slidingFitResultMap to receive the sliding fit results
+     *  @param  extentVector to receive the cluster extents, in cluster list order
+     */
+    void GetClusterExtents(
+        const pandora::ClusterList &clusterList, TwoDSlidingFitResultMap &slidingFitResultMap, ClusterExtentVector &extentVector) const;
+
+    /**
+     *  @brief  Calculate the bounds on the effective x extents of the clusters in all views
+     *
+     *  @param  extentVectorU the u cluster extents
+     *  @param  extentVectorV the v cluster extents
+     *  @param  extentVectorW the w cluster extents
+     */
+    void CalculateEffectiveBounds(
+        ClusterExtentVector &extentVectorU, ClusterExtentVector &extentVectorV, ClusterExtentVector &extentVectorW) const;
+
+    /**
+     *  @brief  Calculate the bounds on the effective x extent of a cluster, for any pair of clusters within the specified x range
+     *
+     *  @param  xMin the min x value above which checks for gaps will be performed
+     *  @param  xMax the max x value below which checks for gaps will be performed
+     *  @param  clusterExtent the cluster extent
+     */
+    void CalculateEffectiveBounds(const float xMin, const float xMax, ClusterExtent &clusterExtent) const;
+
+    /**
+     *  @brief  Whether a sampling point lies in a gap, treating sampling points that cannot be checked as outside gaps
+     *
+     *  @param  xSample the x value of the sampling point
+     *  @param  slidingFitResult the sliding fit result for the cluster
+     *
+     *  @return boolean
+     */
+    bool IsXSamplingPointInGap(const float xSample, const TwoDSlidingFitResult &slidingFitResult) const;
+
     /**
      *  @brief  Find cluster overlaps and record these in the overlap tensor
      *
-     *  @param  clusterList1 the first cluster list
-     *  @param  clusterList2 the second cluster list
+     *  @param  extentVector1 the first cluster extents
+     *  @param  extentVector2 the second cluster extents
      *  @param  overlapTensor the overlap tensor
      */
-    void FindOverlaps(const pandora::ClusterList &clusterList1, const pandora::ClusterList &clusterList2, SimpleOverlapTensor &overlapTensor) const;
+    void FindOverlaps(
+        const ClusterExtentVector &extentVector1, const ClusterExtentVector &extentVector2, SimpleOverlapTensor &overlapTensor) const;
+
+    /**
+     *  @brief  Get the pairs of clusters whose effective x extents could overlap, using a sweep over the clusters ordered in x
+     *
+     *  @param  extentVector1 the first cluster extents
+     *  @param  extentVector2 the second cluster extents
+     *  @param  candidatePairs to receive the positions of the candidate cluster pairs, in cluster list order
+     */
+    void GetCandidatePairs(
+        const ClusterExtentVector &extentVector1, const ClusterExtentVector &extentVector2, IndexPairVector &candidatePairs) const;
 
     /**
      *  @brief  Whether two clusters overlap convincingly in x
      *
-     *  @param  pCluster1 address of the first cluster
-     *  @param  pCluster2 address of the second cluster
+     *  @param  clusterExtent1 the extent of the first cluster
+     *  @param  clusterExtent2 the extent of the second cluster
      */
-    bool IsOverlap(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const;
+    bool IsOverlap(const ClusterExtent &clusterExtent1, const ClusterExtent &clusterExtent2) const;
 
     /**
      *  @brief Calculate effective overlap fractions taking into account gaps
      *
-     *  @param  pCluster1 address of the first cluster
-     *  @param  xMin1 min x value of the first cluster
-     *  @param  xMax1 max x value of the first cluster
-     *  @param  pCluster2 address of the second cluster
-     *  @param  xMin2 min x value of the second cluster
-     *  @param  xMax2 max x value of the second cluster
+     *  @param  clusterExtent1 the extent of the first cluster
+     *  @param  clusterExtent2 the extent of the second cluster
      *  @param  xOverlapFraction1 to receive the effective overlap fraction for the first cluster
      *  @param  xOverlapFraction2 to receive the effective overlap fraction for the second cluster
      */
-    void CalculateEffectiveOverlapFractions(const pandora::Cluster *const pCluster1, const float xMin1, const float xMax1,
-        const pandora::Cluster *const pCluster2, const float xMin2, const float xMax2, float &xOverlapFraction1, float &xOverlapFraction2) const;
+    void CalculateEffectiveOverlapFractions(
+        const ClusterExtent &clusterExtent1, const ClusterExtent &clusterExtent2, float &xOverlapFraction1, float &xOverlapFraction2) const;
 
     /**
      *  @brief  Calculate effective span for a given clsuter taking gaps into account
      *
-     *  @param  pCluster address of the cluster
+     *  @param  slidingFitResult the sliding fit result for the cluster
      *  @param  xMin the min x value above which checks for gaps will be performed
      *  @param  xMax the max x value below which checks for gaps will be performed
      *  @param  xMinEff to receive the effective min x value for the cluster, including adjacent gaps
      *  @param  xMaxEff to receive the effective max x value for the cluster, including adjacent gaps
      */
-    void CalculateEffectiveSpan(const pandora::Cluster *const pCluster, const float xMin, const float xMax, float &xMinEff, float &xMaxEff) const;
+    void CalculateEffectiveSpan(
+        const TwoDSlidingFitResult &slidingFitResult, const float xMin, const float xMax, float &xMinEff, float &xMaxEff) const;
 
     /**
      *  @brief  Identify unambiguous cluster overlaps and resolve ambiguous overlaps, creating new track particles
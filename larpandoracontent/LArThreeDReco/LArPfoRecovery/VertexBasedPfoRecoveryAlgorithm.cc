@@ -14,6 +14,8 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 
+#include <tuple>
+
 using namespace pandora;
 
 namespace lar_content
@@ -50,19 +52,19 @@ StatusCode VertexBasedPfoRecoveryAlgorithm::Run()
     ClusterVector availableClusters;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetAvailableClusters(m_inputClusterListNames, availableClusters));
 
-    // Build a set of sliding fit results
-    TwoDSlidingFitResultMap slidingFitResultMap;
-    this->BuildSlidingFitResultMap(availableClusters, slidingFitResultMap);
+    // Build a set of pointing clusters
+    LArPointingClusterMap pointingClusterMap;
+    this->BuildPointingClusterMap(availableClusters, pointingClusterMap);
 
     // Select seed clusters (adjacent to vertex)
     ClusterVector selectedClusters;
-    this->SelectVertexClusters(pSelectedVertex, slidingFitResultMap, availableClusters, selectedClusters);
+    this->SelectVertexClusters(pSelectedVertex, pointingClusterMap, availableClusters, selectedClusters);
 
     // Match the cluster end points
     ClusterSet vetoList;
     ParticleList particleList;
-    this->MatchThreeViews(pSelectedVertex, slidingFitResultMap, selectedClusters, vetoList, particleList);
-    this->MatchTwoViews(pSelectedVertex, slidingFitResultMap, selectedClusters, vetoList, particleList);
+    this->MatchThreeViews(pSelectedVertex, pointingClusterMap, selectedClusters, vetoList, particleList);
+    this->MatchTwoViews(pSelectedVertex, pointingClusterMap, selectedClusters, vetoList, particleList);
 
     // Build new particles
     this->BuildParticles(particleList);
@@ -109,13 +111,14 @@ StatusCode VertexBasedPfoRecoveryAlgorithm::GetAvailableClusters(const StringVec
 }
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const
+void VertexBasedPfoRecoveryAlgorithm::BuildPointingClusterMap(
+    const ClusterVector &clusterVector, LArPointingClusterMap &pointingClusterMap) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
     for (ClusterVector::const_iterator iter = clusterVector.begin(), iterEnd = clusterVector.end(); iter != iterEnd; ++iter)
     {
-        if (slidingFitResultMap.end() == slidingFitResultMap.find(*iter))
+        if (pointingClusterMap.end() == pointingClusterMap.find(*iter))
         {
             try
             {
@@ -125,7 +128,7 @@ void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
                 if (pointingCluster.GetLengthSquared() < std::numeric_limits<float>::epsilon())
                     continue;
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!pointingClusterMap.insert(LArPointingClusterMap::value_type(*iter, pointingCluster)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -139,7 +142,7 @@ void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
     const ClusterVector &inputClusters, ClusterVector &outputClusters) const
 {
     const CartesianVector vertexU(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), TPC_VIEW_U));
@@ -156,12 +159,11 @@ void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const p
 
         const CartesianVector vertexPosition((TPC_VIEW_U == hitType) ? vertexU : (TPC_VIEW_V == hitType) ? vertexV : vertexW);
 
-        TwoDSlidingFitResultMap::const_iterator sIter = slidingFitResultMap.find(pCluster);
-        if (slidingFitResultMap.end() == sIter)
+        LArPointingClusterMap::const_iterator pIter = pointingClusterMap.find(pCluster);
+        if (pointingClusterMap.end() == pIter)
             continue;
 
-        const TwoDSlidingFitResult &slidingFitResult = sIter->second;
-        const LArPointingCluster pointingCluster(slidingFitResult);
+        const LArPointingCluster &pointingCluster = pIter->second;
 
         for (unsigned int iVtx = 0; iVtx < 2; ++iVtx)
         {
@@ -181,66 +183,83 @@ void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::MatchThreeViews(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::GetClusterEndpoints(const Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
+    const HitType hitType, const ClusterVector &inputClusters, ClusterEndpointVector &endpointVector) const
+{
+    const CartesianVector vertexPosition(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
+
+    for (unsigned int index = 0; index < inputClusters.size(); ++index)
+    {
+        const Cluster *const pCluster(inputClusters.at(index));
+
+        if (hitType != LArClusterHelper::GetClusterHitType(pCluster))
+            continue;
+
+        LArPointingClusterMap::const_iterator pIter = pointingClusterMap.find(pCluster);
+        if (pointingClusterMap.end() == pIter)
+            continue;
+
+        const LArPointingCluster::Vertex &pointingVertex(this->GetOuterVertex(vertexPosition, pIter->second));
+        endpointVector.push_back(ClusterEndpoint(pCluster, hitType, index, pointingVertex.GetPosition()));
+    }
+
+    std::sort(endpointVector.begin(), endpointVector.end(), [](const ClusterEndpoint &lhs, const ClusterEndpoint &rhs) {
+        if (lhs.m_position.GetX() != rhs.m_position.GetX())
+            return (lhs.m_position.GetX() < rhs.m_position.GetX());
+
+        return (lhs.m_index < rhs.m_index);
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VertexBasedPfoRecoveryAlgorithm::MatchThreeViews(const Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
     const ClusterVector &inputClusters, ClusterSet &vetoList, ParticleList &particleList) const
 {
+    ClusterEndpointVector endpointsU, endpointsV, endpointsW;
+    this->GetClusterEndpoints(pVertex, pointingClusterMap, TPC_VIEW_U, inputClusters, endpointsU);
+    this->GetClusterEndpoints(pVertex, pointingClusterMap, TPC_VIEW_V, inputClusters, endpointsV);
+    this->GetClusterEndpoints(pVertex, pointingClusterMap, TPC_VIEW_W, inputClusters, endpointsW);
+
     while (true)
     {
-        ClusterVector availableClusters, clustersU, clustersV, clustersW;
-        this->SelectAvailableClusters(vetoList, inputClusters, availableClusters);
-        this->SelectClusters(TPC_VIEW_U, availableClusters, clustersU);
-        this->SelectClusters(TPC_VIEW_V, availableClusters, clustersV);
-        this->SelectClusters(TPC_VIEW_W, availableClusters, clustersW);
-
         float chi2(m_threeViewChi2Cut);
-        const Cluster *pCluster1(NULL);
-        const Cluster *pCluster2(NULL);
-        const Cluster *pCluster3(NULL);
+        const Cluster *pClusterU(NULL);
+        const Cluster *pClusterV(NULL);
+        const Cluster *pClusterW(NULL);
 
-        this->GetBestChi2(pVertex, slidingFitResultMap, clustersU, clustersV, clustersW, pCluster1, pCluster2, pCluster3, chi2);
+        this->GetBestChi2(endpointsU, endpointsV, endpointsW, vetoList, pClusterU, pClusterV, pClusterW, chi2);
 
-        if (NULL == pCluster1 || NULL == pCluster2 || NULL == pCluster3)
+        if (NULL == pClusterU || NULL == pClusterV || NULL == pClusterW)
             return;
 
-        const HitType hitType1(LArClusterHelper::GetClusterHitType(pCluster1));
-        const HitType hitType2(LArClusterHelper::GetClusterHitType(pCluster2));
-        const HitType hitType3(LArClusterHelper::GetClusterHitType(pCluster3));
-
-        const Cluster *const pClusterU(
-            (TPC_VIEW_U == hitType1) ? pCluster1 : (TPC_VIEW_U == hitType2) ? pCluster2 : (TPC_VIEW_U == hitType3) ? pCluster3 : NULL);
-        const Cluster *const pClusterV(
-            (TPC_VIEW_V == hitType1) ? pCluster1 : (TPC_VIEW_V == hitType2) ? pCluster2 : (TPC_VIEW_V == hitType3) ? pCluster3 : NULL);
-        const Cluster *const pClusterW(
-            (TPC_VIEW_W == hitType1) ? pCluster1 : (TPC_VIEW_W == hitType2) ? pCluster2 : (TPC_VIEW_W == hitType3) ? pCluster3 : NULL);
-
         particleList.push_back(Particle(pClusterU, pClusterV, pClusterW));
 
-        vetoList.insert(pCluster1);
-        vetoList.insert(pCluster2);
-        vetoList.insert(pCluster3);
+        vetoList.insert(pClusterU);
+        vetoList.insert(pClusterV);
+        vetoList.insert(pClusterW);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::MatchTwoViews(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::MatchTwoViews(const Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
     const ClusterVector &inputClusters, ClusterSet &vetoList, ParticleList &particleList) const
 {
+    ClusterEndpointVector endpointsU, endpointsV, endpointsW;
+    this->GetClusterEndpoints(pVertex, pointingClusterMap, TPC_VIEW_U, inputClusters, endpointsU);
+    this->GetClusterEndpoints(pVertex, pointingClusterMap, TPC_VIEW_V, inputClusters, endpointsV);
+    this->GetClusterEndpoints(pVertex, pointingClusterMap, TPC_VIEW_W, inputClusters, endpointsW);
+
     while (true)
     {
-        ClusterVector availableClusters, clustersU, clustersV, clustersW;
-        this->SelectAvailableClusters(vetoList, inputClusters, availableClusters);
-        this->SelectClusters(TPC_VIEW_U, availableClusters, clustersU);
-        this->SelectClusters(TPC_VIEW_V, availableClusters, clustersV);
-        this->SelectClusters(TPC_VIEW_W, availableClusters, clustersW);
-
         float chi2(m_twoViewChi2Cut);
         const Cluster *pCluster1(NULL);
         const Cluster *pCluster2(NULL);
 
-        this->GetBestChi2(pVertex, slidingFitResultMap, clustersU, clustersV, pCluster1, pCluster2, chi2);
-        this->GetBestChi2(pVertex, slidingFitResultMap, clustersV, clustersW, pCluster1, pCluster2, chi2);
-        this->GetBestChi2(pVertex, slidingFitResultMap, clustersW, clustersU, pCluster1, pCluster2, chi2);
+        this->GetBestChi2(endpointsU, endpointsV, vetoList, pCluster1, pCluster2, chi2);
+        this->GetBestChi2(endpointsV, endpointsW, vetoList, pCluster1, pCluster2, chi2);
+        this->GetBestChi2(endpointsW, endpointsU, vetoList, pCluster1, pCluster2, chi2);
 
         if (NULL == pCluster1 || NULL == pCluster2)
             return;
@@ -261,58 +280,69 @@ void VertexBasedPfoRecoveryAlgorithm::MatchTwoViews(const Vertex *const pVertex,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
-    const ClusterVector &clusters1, const ClusterVector &clusters2, const ClusterVector &clusters3, const Cluster *&pBestCluster1,
-    const Cluster *&pBestCluster2, const Cluster *&pBestCluster3, float &bestChi2) const
+void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const ClusterEndpointVector &endpoints1, const ClusterEndpointVector &endpoints2,
+    const ClusterEndpointVector &endpoints3, const ClusterSet &vetoList, const Cluster *&pBestCluster1, const Cluster *&pBestCluster2,
+    const Cluster *&pBestCluster3, float &bestChi2) const
 {
-    if (clusters1.empty() || clusters2.empty() || clusters3.empty())
+    if (endpoints1.empty() || endpoints2.empty() || endpoints3.empty())
         return;
 
+    // ATTN Equivalent matches are resolved in favour of the earliest clusters in the input cluster list, independent of drift ordering
+    bool foundMatch(false);
+    unsigned int bestIndex1(0), bestIndex2(0), bestIndex3(0);
+
+    auto sortByX = [](const ClusterEndpoint &endpoint, const float x) { return endpoint.m_position.GetX() < x; };
+
     // First loop
-    for (ClusterVector::const_iterator cIter1 = clusters1.begin(), cIterEnd1 = clusters1.end(); cIter1 != cIterEnd1; ++cIter1)
+    for (const ClusterEndpoint &endpoint1 : endpoints1)
     {
-        const Cluster *const pCluster1 = *cIter1;
-
-        TwoDSlidingFitResultMap::const_iterator sIter1 = slidingFitResultMap.find(pCluster1);
-        if (slidingFitResultMap.end() == sIter1)
+        if (vetoList.count(endpoint1.m_pCluster))
             continue;
 
-        const TwoDSlidingFitResult &slidingFitResult1 = sIter1->second;
-        const LArPointingCluster pointingCluster1(slidingFitResult1);
+        const float x1(endpoint1.m_position.GetX());
+
+        // Second loop, over endpoints within the drift window, which narrows as the best chi-squared improves
+        const float minX2(x1 - this->GetMaxDriftSeparation(bestChi2));
 
-        // Second loop
-        for (ClusterVector::const_iterator cIter2 = clusters2.begin(), cIterEnd2 = clusters2.end(); cIter2 != cIterEnd2; ++cIter2)
+        for (auto iter2 = std::lower_bound(endpoints2.begin(), endpoints2.end(), minX2, sortByX); iter2 != endpoints2.end(); ++iter2)
         {
-            const Cluster *const pCluster2 = *cIter2;
+            const ClusterEndpoint &endpoint2(*iter2);
 
-            TwoDSlidingFitResultMap::const_iterator sIter2 = slidingFitResultMap.find(pCluster2);
-            if (slidingFitResultMap.end() == sIter2)
-                continue;
+            if (endpoint2.m_position.GetX() > x1 + this->GetMaxDriftSeparation(bestChi2))
+                break;
 
-            const TwoDSlidingFitResult &slidingFitResult2 = sIter2->second;
-            const LArPointingCluster pointingCluster2(slidingFitResult2);
+            if (vetoList.count(endpoint2.m_pCluster))
+                continue;
 
             // Third loop
-            for (ClusterVector::const_iterator cIter3 = clusters3.begin(), cIterEnd3 = clusters3.end(); cIter3 != cIterEnd3; ++cIter3)
+            const float minX3(x1 - this->GetMaxDriftSeparation(bestChi2));
+
+            for (auto iter3 = std::lower_bound(endpoints3.begin(), endpoints3.end(), minX3, sortByX); iter3 != endpoints3.end(); ++iter3)
             {
-                const Cluster *const pCluster3 = *cIter3;
+                const ClusterEndpoint &endpoint3(*iter3);
 
-                TwoDSlidingFitResultMap::const_iterator sIter3 = slidingFitResultMap.find(pCluster3);
-                if (slidingFitResultMap.end() == sIter3)
-                    continue;
+                if (endpoint3.m_position.GetX() > x1 + this->GetMaxDriftSeparation(bestChi2))
+                    break;
 
-                const TwoDSlidingFitResult &slidingFitResult3 = sIter3->second;
-                const LArPointingCluster pointingCluster3(slidingFitResult3);
+                if (vetoList.count(endpoint3.m_pCluster))
+                    continue;
 
                 // Calculate chi-squared
-                const float thisChi2(this->GetChi2(pVertex, pointingCluster1, pointingCluster2, pointingCluster3));
+                const float thisChi2(this->GetChi2(endpoint1, endpoint2, endpoint3));
 
-                if (thisChi2 < bestChi2)
+                const bool isEarlierMatch(foundMatch && (std::make_tuple(endpoint1.m_index, endpoint2.m_index, endpoint3.m_index) <
+                                                            std::make_tuple(bestIndex1, bestIndex2, bestIndex3)));
+
+                if ((thisChi2 < bestChi2) || ((thisChi2 == bestChi2) && isEarlierMatch))
                 {
+                    foundMatch = true;
                     bestChi2 = thisChi2;
-                    pBestCluster1 = pCluster1;
-                    pBestCluster2 = pCluster2;
-                    pBestCluster3 = pCluster3;
+                    bestIndex1 = endpoint1.m_index;
+                    bestIndex2 = endpoint2.m_index;
+                    bestIndex3 = endpoint3.m_index;
+                    pBestCluster1 = endpoint1.m_pCluster;
+                    pBestCluster2 = endpoint2.m_pCluster;
+                    pBestCluster3 = endpoint3.m_pCluster;
                 }
             }
         }
@@ -321,44 +351,53 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
-    const ClusterVector &clusters1, const ClusterVector &clusters2, const Cluster *&pBestCluster1, const Cluster *&pBestCluster2, float &bestChi2) const
+void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const ClusterEndpointVector &endpoints1, const ClusterEndpointVector &endpoints2,
+    const ClusterSet &vetoList, const Cluster *&pBestCluster1, const Cluster *&pBestCluster2, float &bestChi2) const
 {
-    if (clusters1.empty() || clusters2.empty())
+    if (endpoints1.empty() || endpoints2.empty())
         return;
 
+    // ATTN Equivalent matches are resolved in favour of the earliest clusters in the input cluster list, independent of drift ordering
+    bool foundMatch(false);
+    unsigned int bestIndex1(0), bestIndex2(0);
+
+    auto sortByX = [](const ClusterEndpoint &endpoint, const float x) { return endpoint.m_position.GetX() < x; };
+
     // First loop
-    for (ClusterVector::const_iterator cIter1 = clusters1.begin(), cIterEnd1 = clusters1.end(); cIter1 != cIterEnd1; ++cIter1)
+    for (const ClusterEndpoint &endpoint1 : endpoints1)
     {
-        const Cluster *const pCluster1 = *cIter1;
-
-        TwoDSlidingFitResultMap::const_iterator sIter1 = slidingFitResultMap.find(pCluster1);
-        if (slidingFitResultMap.end() == sIter1)
+        if (vetoList.count(endpoint1.m_pCluster))
             continue;
 
-        const TwoDSlidingFitResult &slidingFitResult1 = sIter1->second;
-        const LArPointingCluster pointingCluster1(slidingFitResult1);
+        const float x1(endpoint1.m_position.GetX());
+
+        // Second loop, over endpoints within the drift window, which narrows as the best chi-squared improves
+        const float minX2(x1 - this->GetMaxDriftSeparation(bestChi2));
 
-        // Second loop
-        for (ClusterVector::const_iterator cIter2 = clusters2.begin(), cIterEnd2 = clusters2.end(); cIter2 != cIterEnd2; ++cIter2)
+        for (auto iter2 = std::lower_bound(endpoints2.begin(), endpoints2.end(), minX2, sortByX); iter2 != endpoints2.end(); ++iter2)
         {
-            const Cluster *const pCluster2 = *cIter2;
+            const ClusterEndpoint &endpoint2(*iter2);
 
-            TwoDSlidingFitResultMap::const_iterator sIter2 = slidingFitResultMap.find(pCluster2);
-            if (slidingFitResultMap.end() == sIter2)
-                continue;
+            if (endpoint2.m_position.GetX() > x1 + this->GetMaxDriftSeparation(bestChi2))
+                break;
 
-            const TwoDSlidingFitResult &slidingFitResult2 = sIter2->second;
-            const LArPointingCluster pointingCluster2(slidingFitResult2);
+            if (vetoList.count(endpoint2.m_pCluster))
+                continue;
 
             // Calculate chi-squared
-            const float thisChi2(this->GetChi2(pVertex, pointingCluster1, pointingCluster2));
+            const float thisChi2(this->GetChi2(endpoint1, endpoint2));
 
-            if (thisChi2 < bestChi2)
+            const bool isEarlierMatch(
+                foundMatch && (std::make_pair(endpoint1.m_index, endpoint2.m_index) < std::make_pair(bestIndex1, bestIndex2)));
+
+            if ((thisChi2 < bestChi2) || ((thisChi2 == bestChi2) && isEarlierMatch))
             {
+                foundMatch = true;
                 bestChi2 = thisChi2;
-                pBestCluster1 = pCluster1;
-                pBestCluster2 = pCluster2;
+                bestIndex1 = endpoint1.m_index;
+                bestIndex2 = endpoint2.m_index;
+                pBestCluster1 = endpoint1.m_pCluster;
+                pBestCluster2 = endpoint2.m_pCluster;
             }
         }
     }
@@ -366,81 +405,49 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float VertexBasedPfoRecoveryAlgorithm::GetChi2(
-    const Vertex *const pVertex, const LArPointingCluster &pointingCluster1, const LArPointingCluster &pointingCluster2) const
+float VertexBasedPfoRecoveryAlgorithm::GetMaxDriftSeparation(const float chi2) const
 {
-    const HitType hitType1(LArClusterHelper::GetClusterHitType(pointingCluster1.GetCluster()));
-    const HitType hitType2(LArClusterHelper::GetClusterHitType(pointingCluster2.GetCluster()));
-
-    if (hitType1 == hitType2)
-        throw StatusCodeException(STATUS_CODE_FAILURE);
+    // ATTN Chi-squared includes the drift spread of the merged positions, which is at least (x1 - x2)^2 / (2 sigma^2) for any pair of
+    // positions. Pad slightly, so that rounding can never exclude a match that would otherwise have been accepted.
+    const float sigmaUVW(LArGeometryHelper::GetSigmaUVW(this->GetPandora()));
+    return 1.001f * sigmaUVW * std::sqrt(2.f * std::max(0.f, chi2));
+}
 
-    const CartesianVector vertex1(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType1));
-    const CartesianVector vertex2(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType2));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    const LArPointingCluster::Vertex &pointingVertex1(this->GetOuterVertex(vertex1, pointingCluster1));
-    const LArPointingCluster::Vertex &pointingVertex2(this->GetOuterVertex(vertex2, pointingCluster2));
+float VertexBasedPfoRecoveryAlgorithm::GetChi2(const ClusterEndpoint &endpoint1, const ClusterEndpoint &endpoint2) const
+{
+    if (endpoint1.m_hitType == endpoint2.m_hitType)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
 
     float chi2(0.f);
     CartesianVector mergedPosition(0.f, 0.f, 0.f);
     LArGeometryHelper::MergeTwoPositions3D(
-        this->GetPandora(), hitType1, hitType2, pointingVertex1.GetPosition(), pointingVertex2.GetPosition(), mergedPosition, chi2);
+        this->GetPandora(), endpoint1.m_hitType, endpoint2.m_hitType, endpoint1.m_position, endpoint2.m_position, mergedPosition, chi2);
 
     return chi2;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float VertexBasedPfoRecoveryAlgorithm::GetChi2(const Vertex *const pVertex, const LArPointingCluster &pointingCluster1,
-    const LArPointingCluster &pointingCluster2, const LArPointingCluster &pointingCluster3) const
+float VertexBasedPfoRecoveryAlgorithm::GetChi2(
+    const ClusterEndpoint &endpoint1, const ClusterEndpoint &endpoint2, const ClusterEndpoint &endpoint3) const
 {
-    const HitType hitType1(LArClusterHelper::GetClusterHitType(pointingCluster1.GetCluster()));
-    const HitType hitType2(LArClusterHelper::GetClusterHitType(pointingCluster2.GetCluster()));
-    const HitType hitType3(LArClusterHelper::GetClusterHitType(pointingCluster3.GetCluster()));
+    const HitType hitType1(endpoint1.m_hitType), hitType2(endpoint2.m_hitType), hitType3(endpoint3.m_hitType);
 
     if ((hitType1 == hitType2) || (hitType2 == hitType3) || (hitType3 == hitType1))
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    const CartesianVector vertex1(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType1));
-    const CartesianVector vertex2(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType2));
-    const CartesianVector vertex3(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType3));
-
-    const LArPointingCluster::Vertex &pointingVertex1(this->GetOuterVertex(vertex1, pointingCluster1));
-    const LArPointingCluster::Vertex &pointingVertex2(this->GetOuterVertex(vertex2, pointingCluster2));
-    const LArPointingCluster::Vertex &pointingVertex3(this->GetOuterVertex(vertex3, pointingCluster3));
-
     float chi2(0.f);
     CartesianVector mergedPosition(0.f, 0.f, 0.f);
-    LArGeometryHelper::MergeThreePositions3D(this->GetPandora(), hitType1, hitType2, hitType3, pointingVertex1.GetPosition(),
-        pointingVertex2.GetPosition(), pointingVertex3.GetPosition(), mergedPosition, chi2);
+    LArGeometryHelper::MergeThreePositions3D(this->GetPandora(), hitType1, hitType2, hitType3, endpoint1.m_position, endpoint2.m_position,
+        endpoint3.m_position, mergedPosition, chi2);
 
     return chi2;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::SelectAvailableClusters(const ClusterSet &vetoList, const ClusterVector &inputVector, ClusterVector &outputVector) const
-{
-    for (ClusterVector::const_iterator iter = inputVector.begin(), iterEnd = inputVector.end(); iter != iterEnd; ++iter)
-    {
-        if (0 == vetoList.count(*iter))
-            outputVector.push_back(*iter);
-    }
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-void VertexBasedPfoRecoveryAlgorithm::SelectClusters(const HitType hitType, const ClusterVector &inputVector, ClusterVector &outputVector) const
-{
-    for (ClusterVector::const_iterator iter = inputVector.begin(), iterEnd = inputVector.end(); iter != iterEnd; ++iter)
-    {
-        if (hitType == LArClusterHelper::GetClusterHitType(*iter))
-            outputVector.push_back(*iter);
-    }
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 const LArPointingCluster::Vertex &VertexBasedPfoRecoveryAlgorithm::GetInnerVertex(const CartesianVector &vertex, const LArPointingCluster &cluster) const
 {
     const float innerDistance((vertex - cluster.GetInnerVertex().GetPosition()).GetMagnitudeSquared());
@@ -535,6 +542,17 @@ VertexBasedPfoRecoveryAlgorithm::Particle::Particle(const Cluster *const pCluste
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+VertexBasedPfoRecoveryAlgorithm::ClusterEndpoint::ClusterEndpoint(
+    const Cluster *const pCluster, const HitType hitType, const unsigned int index, const CartesianVector &position) :
+    m_pCluster(pCluster),
+    m_hitType(hitType),
+    m_index(index),
+    m_position(position)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexBasedPfoRecoveryAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "InputClusterListNames", m_inputClusterListNames));
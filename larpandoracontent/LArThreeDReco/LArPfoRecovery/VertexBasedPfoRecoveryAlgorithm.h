@@ -52,6 +52,31 @@ private:
 
     typedef std::vector<Particle> ParticleList;
 
+    /**
+     *  @brief  ClusterEndpoint class, caching the end of a pointing cluster furthest from the projected candidate vertex
+     */
+    class ClusterEndpoint
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         *  @param  hitType the hit type of the cluster
+         *  @param  index the position of the cluster in the input cluster vector
+         *  @param  position the position of the end of the cluster furthest from the projected vertex
+         */
+        ClusterEndpoint(const pandora::Cluster *const pCluster, const pandora::HitType hitType, const unsigned int index,
+            const pandora::CartesianVector &position);
+
+        const pandora::Cluster *m_pCluster;  ///< Address of the cluster
+        pandora::HitType m_hitType;          ///< The hit type of the cluster
+        unsigned int m_index;                ///< The position of the cluster in the input cluster vector, used to order equivalent matches
+        pandora::CartesianVector m_position; ///< The position of the end of the cluster furthest from the projected vertex
+    };
+
+    typedef std::vector<ClusterEndpoint> ClusterEndpointVector;
+
     /**
      *  @brief Get a vector of available clusters
      *
@@ -61,117 +86,114 @@ private:
     pandora::StatusCode GetAvailableClusters(const pandora::StringVector inputClusterListName, pandora::ClusterVector &clusterVector) const;
 
     /**
-     *  @brief  Build the map of sliding fit results
+     *  @brief  Build the map of pointing clusters, from a sliding fit to each cluster
      *
      *  @param  clusterVector the vector of selected clusters
-     *  @param  halfWindowLayers the half-window to use for the sliding fits
-     *  @param  slidingFitResultMap the sliding fit result map
+     *  @param  pointingClusterMap the pointing cluster map
      */
-    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const;
+    void BuildPointingClusterMap(const pandora::ClusterVector &clusterVector, LArPointingClusterMap &pointingClusterMap) const;
 
     /**
      *  @brief  Select clusters in proximity to reconstructed vertex
      *
      *  @param  pVertex  the input vertex
-     *  @param  slidingFitResultMap  the mapping between clusters and sliding fit results
+     *  @param  pointingClusterMap  the mapping between clusters and pointing clusters
      *  @param  inputClusters  the input vector of clusters
      *  @param  outputClusters  the output vector of clusters
      */
-    void SelectVertexClusters(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    void SelectVertexClusters(const pandora::Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
         const pandora::ClusterVector &inputClusters, pandora::ClusterVector &outputClusters) const;
 
+    /**
+     *  @brief  Get the ends of the clusters of a specified hit type furthest from the projected vertex, sorted by drift position
+     *
+     *  @param  pVertex  the input vertex
+     *  @param  pointingClusterMap  the mapping between clusters and pointing clusters
+     *  @param  hitType  the specified hit type
+     *  @param  inputClusters  the input vector of clusters
+     *  @param  endpointVector  the output vector of cluster endpoints
+     */
+    void GetClusterEndpoints(const pandora::Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
+        const pandora::HitType hitType, const pandora::ClusterVector &inputClusters, ClusterEndpointVector &endpointVector) const;
+
     /**
      *  @brief  Match clusters from three views
      *
      *  @param  pVertex  the input vertex
-     *  @param  slidingFitResultMap  the mapping between clusters and sliding fit results
+     *  @param  pointingClusterMap  the mapping between clusters and pointing clusters
      *  @param  selectedClusters  the input vertex clusters
      *  @param  vetoList  the list of matched clusters
      *  @param  particleList the output list of matched clusters
      */
-    void MatchThreeViews(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    void MatchThreeViews(const pandora::Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
         const pandora::ClusterVector &selectedClusters, pandora::ClusterSet &vetoList, ParticleList &particleList) const;
 
     /**
      *  @brief  Match clusters from two views
      *
      *  @param  pVertex  the input vertex
-     *  @param  slidingFitResultMap  the mapping between clusters and sliding fit results
+     *  @param  pointingClusterMap  the mapping between clusters and pointing clusters
      *  @param  selectedClusters  the input vertex clusters
      *  @param  vetoList  the list of matched clusters
      *  @param  particleList  the output list of matched clusters
      */
-    void MatchTwoViews(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    void MatchTwoViews(const pandora::Vertex *const pVertex, const LArPointingClusterMap &pointingClusterMap,
         const pandora::ClusterVector &selectedClusters, pandora::ClusterSet &vetoList, ParticleList &particleList) const;
 
     /**
-     *  @brief  Get best-matched triplet of clusters from a set of input cluster vectors
+     *  @brief  Get best-matched triplet of clusters from a set of input cluster endpoint vectors
      *
-     *  @param  pVertex  the input vertex
-     *  @param  slidingFitResultMap  the mapping between clusters and sliding fit results
-     *  @param  clusters1  the clusters in the first view
-     *  @param  clusters2  the clusters in the second view
-     *  @param  clusters3  the clusters in the third view
+     *  @param  endpoints1  the cluster endpoints in the first view, sorted by drift position
+     *  @param  endpoints2  the cluster endpoints in the second view, sorted by drift position
+     *  @param  endpoints3  the cluster endpoints in the third view, sorted by drift position
+     *  @param  vetoList  the list of matched clusters, which are not considered
      *  @param  pBestCluster1  the best-matched cluster from the first view
      *  @param  pBestCluster2  the best-matched cluster from the second view
      *  @param  pBestCluster3  the best-matched cluster from the third view
      *  @param  chi2  the chi-squared metric from the best match
      */
-    void GetBestChi2(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
-        const pandora::ClusterVector &clusters1, const pandora::ClusterVector &clusters2, const pandora::ClusterVector &clusters3,
-        const pandora::Cluster *&pBestCluster1, const pandora::Cluster *&pBestCluster2, const pandora::Cluster *&pBestCluster3, float &chi2) const;
+    void GetBestChi2(const ClusterEndpointVector &endpoints1, const ClusterEndpointVector &endpoints2,
+        const ClusterEndpointVector &endpoints3, const pandora::ClusterSet &vetoList, const pandora::Cluster *&pBestCluster1,
+        const pandora::Cluster *&pBestCluster2, const pandora::Cluster *&pBestCluster3, float &chi2) const;
 
     /**
-     *  @brief  Get best-matched pair of clusters from a set of input cluster vectors
+     *  @brief  Get best-matched pair of clusters from a set of input cluster endpoint vectors
      *
-     *  @param  pVertex  the input vertex
-     *  @param  slidingFitResultMap  the mapping between clusters and sliding fit results
-     *  @param  clusters1 the clusters in the first view
-     *  @param  clusters2 the clusters in the second view
+     *  @param  endpoints1  the cluster endpoints in the first view, sorted by drift position
+     *  @param  endpoints2  the cluster endpoints in the second view, sorted by drift position
+     *  @param  vetoList  the list of matched clusters, which are not considered
      *  @param  pBestCluster1 the best-matched cluster from the first view
      *  @param  pBestCluster2 the best-matched cluster from the second view
      *  @param  chi2 the chi-squared metric from the best match
      */
-    void GetBestChi2(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap, const pandora::ClusterVector &clusters1,
-        const pandora::ClusterVector &clusters2, const pandora::Cluster *&pBestCluster1, const pandora::Cluster *&pBestCluster2, float &chi2) const;
+    void GetBestChi2(const ClusterEndpointVector &endpoints1, const ClusterEndpointVector &endpoints2, const pandora::ClusterSet &vetoList,
+        const pandora::Cluster *&pBestCluster1, const pandora::Cluster *&pBestCluster2, float &chi2) const;
 
     /**
-     *  @brief  Merge two pointing clusters and return chi-squared metric giving consistency of matching
+     *  @brief  Get the maximum drift separation between two cluster endpoints for which a match could have chi-squared below a given value
      *
-     *  @param  pVertex  the input vertex
-     *  @param  pointingCluster1  the first pointing cluster
-     *  @param  pointingCluster2  the second pointing cluster
-     */
-    float GetChi2(const pandora::Vertex *const pVertex, const LArPointingCluster &pointingCluster1, const LArPointingCluster &pointingCluster2) const;
-
-    /**
-     *  @brief  Merge three clusters between views and return chi-squared metric giving consistency of matching
+     *  @param  chi2  the chi-squared value
      *
-     *  @param  pVertex  the input vertex
-     *  @param  pointingCluster1  the first pointing cluster
-     *  @param  pointingCluster2  the second pointing cluster
-     *  @param  pointingCluster3  the third pointing cluster
+     *  @return the maximum drift separation
      */
-    float GetChi2(const pandora::Vertex *const pVertex, const LArPointingCluster &pointingCluster1,
-        const LArPointingCluster &pointingCluster2, const LArPointingCluster &pointingCluster3) const;
+    float GetMaxDriftSeparation(const float chi2) const;
 
     /**
-     *  @brief  Select cluster which haven't been vetoed
+     *  @brief  Merge two cluster endpoints and return chi-squared metric giving consistency of matching
      *
-     *  @param  vetoList  the list of vetoed clusters
-     *  @param  inputVector  the input vector of clusters
-     *  @param  outputVector  the output vector of clusters
+     *  @param  endpoint1  the first cluster endpoint
+     *  @param  endpoint2  the second cluster endpoint
      */
-    void SelectAvailableClusters(const pandora::ClusterSet &vetoList, const pandora::ClusterVector &inputVector, pandora::ClusterVector &outputVector) const;
+    float GetChi2(const ClusterEndpoint &endpoint1, const ClusterEndpoint &endpoint2) const;
 
     /**
-     *  @brief  Select clusters of a specified hit type
+     *  @brief  Merge three cluster endpoints between views and return chi-squared metric giving consistency of matching
      *
-     *  @param  hitType  the specified hit type
-     *  @param  inputVector  the input vector of clusters
-     *  @param  outputVector  the output vector of clusters
+     *  @param  endpoint1  the first cluster endpoint
+     *  @param  endpoint2  the second cluster endpoint
+     *  @param  endpoint3  the third cluster endpoint
      */
-    void SelectClusters(const pandora::HitType hitType, const pandora::ClusterVector &inputVector, pandora::ClusterVector &outputVector) const;
+    float GetChi2(const ClusterEndpoint &endpoint1, const ClusterEndpoint &endpoint2, const ClusterEndpoint &endpoint3) const;
 
     /**
      *  @brief  Find nearest end of pointing cluster to a specified position vector
@@ -49,8 +49,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
     if (pCluster->GetNCaloHits() < m_minCaloHitsCut)
         return false;
 
-    StringVector featureOrder;
-    const LArMvaHelper::MvaFeatureMap featureMap(LArMvaHelper::CalculateFeatures(m_algorithmToolNames, m_featureToolMap, featureOrder, this, pCluster));
+    LArMvaHelper::FillFeatures(m_featureToolVector, m_featureOrder, m_featureVector, this, pCluster);
 
     if (m_trainingSetMode)
     {
@@ -65,17 +64,17 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
         {
         }
 
-        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, featureOrder, featureMap);
+        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, m_featureVector);
         return isTrueTrack;
     }
 
     if (!m_enableProbability)
     {
-        return LArMvaHelper::Classify(m_mva, featureOrder, featureMap);
+        return LArMvaHelper::Classify(m_mva, m_featureVector);
     }
     else
     {
-        return (LArMvaHelper::CalculateProbability(m_mva, featureOrder, featureMap) > m_minProbabilityCut);
+        return (LArMvaHelper::CalculateProbability(m_mva, m_featureVector) > m_minProbabilityCut);
     }
 }
 
@@ -99,16 +98,13 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
     ClusterList wClusterList;
     LArPfoHelper::GetClusters(pPfo, TPC_VIEW_W, wClusterList);
 
-    const PfoCharacterisationFeatureTool::FeatureToolMap &chosenFeatureToolMap(wClusterList.empty() ? m_featureToolMapNoChargeInfo : m_featureToolMapThreeD);
-    const StringVector chosenFeatureToolOrder(wClusterList.empty() ? m_algorithmToolNamesNoChargeInfo : m_algorithmToolNames);
-    StringVector featureOrder;
-    const LArMvaHelper::MvaFeatureMap featureMap(
-        LArMvaHelper::CalculateFeatures(chosenFeatureToolOrder, chosenFeatureToolMap, featureOrder, this, pPfo));
+    const PfoCharacterisationFeatureTool::FeatureToolVector &chosenFeatureToolVector(
+        wClusterList.empty() ? m_featureToolVectorNoChargeInfo : m_featureToolVectorThreeD);
+    const StringVector &chosenFeatureOrder(wClusterList.empty() ? m_featureOrderNoChargeInfo : m_featureOrder);
+    LArMvaHelper::FillFeatures(chosenFeatureToolVector, chosenFeatureOrder, m_featureVector, this, pPfo);
 
-    for (auto const &[featureKey, featureValue] : featureMap)
+    for (const LArMvaHelper::MvaFeature &featureValue : m_featureVector)
     {
-        (void)featureKey;
-
         if (!featureValue.IsInitialized())
         {
             if (m_enableProbability)
@@ -231,7 +227,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
                 std::string outputFile(m_trainingOutputFile);
                 const std::string end = ((wClusterList.empty()) ? "noChargeInfo.txt" : ".txt");
                 outputFile.append(end);
-                LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap);
+                LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, m_featureVector);
             }
         }
 
@@ -256,7 +252,7 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
         {
             std::string outputFile(m_trainingOutputFile);
             outputFile.append(wClusterList.empty() ? "noChargeInfo.txt" : ".txt");
-            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureOrder, featureMap);
+            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, m_featureVector);
         }
 
         return isTrueTrack;
@@ -265,18 +261,18 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
     // If no failures, proceed with MvaPfoCharacterisationAlgorithm classification
     if (!m_enableProbability)
     {
-        return LArMvaHelper::Classify((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), featureOrder, featureMap);
+        return LArMvaHelper::Classify((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), m_featureVector);
     }
     else
     {
-        const double score(LArMvaHelper::CalculateProbability((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), featureOrder, featureMap));
+        const double score(LArMvaHelper::CalculateProbability((wClusterList.empty() ? m_mvaNoChargeInfo : m_mva), m_featureVector));
         object_creation::ParticleFlowObject::Metadata metadata;
         metadata.m_propertiesToAdd["TrackScore"] = score;
         if (m_persistFeatures)
         {
-            for (auto const &[name, value] : featureMap)
+            for (size_t iFeature = 0; iFeature < chosenFeatureOrder.size(); ++iFeature)
             {
-                metadata.m_propertiesToAdd[name] = value.Get();
+                metadata.m_propertiesToAdd[chosenFeatureOrder.at(iFeature)] = m_featureVector.at(iFeature).Get();
             }
         }
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
@@ -417,11 +413,21 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
         for (auto const &[pAlgorithmToolName, pAlgorithmTool] : algorithmToolMapNoChargeInfo)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 LArMvaHelper::AddFeatureToolToMap(pAlgorithmTool, pAlgorithmToolName, m_featureToolMapNoChargeInfo));
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            LArMvaHelper::RegisterFeatures(m_algorithmToolNames, m_featureToolMapThreeD, m_featureToolVectorThreeD, m_featureOrder));
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            LArMvaHelper::RegisterFeatures(
+                m_algorithmToolNamesNoChargeInfo, m_featureToolMapNoChargeInfo, m_featureToolVectorNoChargeInfo, m_featureOrderNoChargeInfo));
     }
     else
     {
         for (auto const &[pAlgorithmToolName, pAlgorithmTool] : algorithmToolMap)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMvaHelper::AddFeatureToolToMap(pAlgorithmTool, pAlgorithmToolName, m_featureToolMap));
+
+        PANDORA_RETURN_RESULT_IF(
+            STATUS_CODE_SUCCESS, !=, LArMvaHelper::RegisterFeatures(m_algorithmToolNames, m_featureToolMap, m_featureToolVector, m_featureOrder));
     }
 
     return PfoCharacterisationBaseAlgorithm::ReadSettings(xmlHandle);
@@ -46,6 +46,13 @@ protected:
     pandora::StringVector m_algorithmToolNames; ///< Vector of strings saving feature tool order for use in feature calculation
     pandora::StringVector m_algorithmToolNamesNoChargeInfo; ///< Vector of strings saving feature tool order for use in feature calculation (missing W view)
 
+    ClusterCharacterisationFeatureTool::FeatureToolVector m_featureToolVector;         ///< The registered feature tools, in feature id order
+    PfoCharacterisationFeatureTool::FeatureToolVector m_featureToolVectorThreeD;       ///< The registered 3D feature tools, in feature id order
+    PfoCharacterisationFeatureTool::FeatureToolVector m_featureToolVectorNoChargeInfo; ///< The registered feature tools for missing W view
+    pandora::StringVector m_featureOrder;                                              ///< The registered feature names, indexed by feature id
+    pandora::StringVector m_featureOrderNoChargeInfo;       ///< The registered feature names for missing W view, indexed by feature id
+    mutable LArMvaHelper::MvaFeatureVector m_featureVector; ///< Feature buffer, reused between classifications
+
     T m_mva;             ///< The mva
     T m_mvaNoChargeInfo; ///< The mva for missing W view
 
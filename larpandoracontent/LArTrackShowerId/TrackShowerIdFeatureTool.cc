@@ -53,20 +53,9 @@ void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDShowerFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+void TwoDShowerFitFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pCluster);
-
-    if (featureMap.find(featureToolName + "_WidthLenRatio") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_WidthLenRatio");
-    featureMap[featureToolName + "_WidthLenRatio"] = toolFeatureVec[0].Get();
+    featureNames.push_back(featureToolName + "_WidthLenRatio");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -120,36 +109,14 @@ void TwoDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+void TwoDLinearFitFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pCluster);
-
-    if (featureMap.find(featureToolName + "_StLineLenLarge") != featureMap.end() ||
-        featureMap.find(featureToolName + "_DiffStLineMean") != featureMap.end() ||
-        featureMap.find(featureToolName + "_DiffStLineSigma") != featureMap.end() ||
-        featureMap.find(featureToolName + "_dTdLWidth") != featureMap.end() ||
-        featureMap.find(featureToolName + "_MaxFitGapLen") != featureMap.end() ||
-        featureMap.find(featureToolName + "_rmsSlidingLinFit") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_StLineLenLarge");
-    featureOrder.push_back(featureToolName + "_DiffStLineMean");
-    featureOrder.push_back(featureToolName + "_DiffStLineSigma");
-    featureOrder.push_back(featureToolName + "_dTdLWidth");
-    featureOrder.push_back(featureToolName + "_MaxFitGapLen");
-    featureOrder.push_back(featureToolName + "_rmsSlidingLinFit");
-
-    featureMap[featureToolName + "_StLineLenLarge"] = toolFeatureVec[0].Get();
-    featureMap[featureToolName + "_DiffStLineMean"] = toolFeatureVec[1].Get();
-    featureMap[featureToolName + "_DiffStLineSigma"] = toolFeatureVec[2].Get();
-    featureMap[featureToolName + "_dTdLWidth"] = toolFeatureVec[3].Get();
-    featureMap[featureToolName + "_MaxFitGapLen"] = toolFeatureVec[4].Get();
-    featureMap[featureToolName + "_rmsSlidingLinFit"] = toolFeatureVec[5].Get();
+    featureNames.push_back(featureToolName + "_StLineLenLarge");
+    featureNames.push_back(featureToolName + "_DiffStLineMean");
+    featureNames.push_back(featureToolName + "_DiffStLineSigma");
+    featureNames.push_back(featureToolName + "_dTdLWidth");
+    featureNames.push_back(featureToolName + "_MaxFitGapLen");
+    featureNames.push_back(featureToolName + "_rmsSlidingLinFit");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -285,20 +252,9 @@ void TwoDVertexDistanceFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster)
+void TwoDVertexDistanceFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pCluster);
-
-    if (featureMap.find(featureToolName + "_DistLenRatio") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_DistLenRatio");
-    featureMap[featureToolName + "_DistLenRatio"] = toolFeatureVec[0].Get();
+    featureNames.push_back(featureToolName + "_DistLenRatio");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -361,27 +317,11 @@ void PfoHierarchyFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PfoHierarchyFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void PfoHierarchyFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
-
-    if (featureMap.find(featureToolName + "_NDaughters") != featureMap.end() ||
-        featureMap.find(featureToolName + "_NDaughterHits3D") != featureMap.end() ||
-        featureMap.find(featureToolName + "_DaughterParentHitRatio") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_NDaughters");
-    featureOrder.push_back(featureToolName + "_NDaughterHits3D");
-    featureOrder.push_back(featureToolName + "_DaughterParentHitRatio");
-
-    featureMap[featureToolName + "_NDaughters"] = toolFeatureVec[0].Get();
-    featureMap[featureToolName + "_NDaughterHits3D"] = toolFeatureVec[1].Get();
-    featureMap[featureToolName + "_DaughterParentHitRatio"] = toolFeatureVec[2].Get();
+    featureNames.push_back(featureToolName + "_NDaughters");
+    featureNames.push_back(featureToolName + "_NDaughterHits3D");
+    featureNames.push_back(featureToolName + "_DaughterParentHitRatio");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -444,27 +384,11 @@ void ConeChargeFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ConeChargeFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ConeChargeFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
-
-    if (featureMap.find(featureToolName + "_HaloTotalRatio") != featureMap.end() ||
-        featureMap.find(featureToolName + "_Concentration") != featureMap.end() ||
-        featureMap.find(featureToolName + "_Conicalness") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_HaloTotalRatio");
-    featureOrder.push_back(featureToolName + "_Concentration");
-    featureOrder.push_back(featureToolName + "_Conicalness");
-
-    featureMap[featureToolName + "_HaloTotalRatio"] = toolFeatureVec[0].Get();
-    featureMap[featureToolName + "_Concentration"] = toolFeatureVec[1].Get();
-    featureMap[featureToolName + "_Conicalness"] = toolFeatureVec[2].Get();
+    featureNames.push_back(featureToolName + "_HaloTotalRatio");
+    featureNames.push_back(featureToolName + "_Concentration");
+    featureNames.push_back(featureToolName + "_Conicalness");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -596,30 +520,12 @@ void ThreeDLinearFitFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDLinearFitFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDLinearFitFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
-
-    if (featureMap.find(featureToolName + "_Length") != featureMap.end() ||
-        featureMap.find(featureToolName + "_DiffStraightLineMean") != featureMap.end() ||
-        featureMap.find(featureToolName + "_MaxFitGapLength") != featureMap.end() ||
-        featureMap.find(featureToolName + "_SlidingLinearFitRMS") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_Length");
-    featureOrder.push_back(featureToolName + "_DiffStraightLineMean");
-    featureOrder.push_back(featureToolName + "_MaxFitGapLength");
-    featureOrder.push_back(featureToolName + "_SlidingLinearFitRMS");
-
-    featureMap[featureToolName + "_Length"] = toolFeatureVec[0].Get();
-    featureMap[featureToolName + "_DiffStraightLineMean"] = toolFeatureVec[1].Get();
-    featureMap[featureToolName + "_MaxFitGapLength"] = toolFeatureVec[2].Get();
-    featureMap[featureToolName + "_SlidingLinearFitRMS"] = toolFeatureVec[3].Get();
+    featureNames.push_back(featureToolName + "_Length");
+    featureNames.push_back(featureToolName + "_DiffStraightLineMean");
+    featureNames.push_back(featureToolName + "_MaxFitGapLength");
+    featureNames.push_back(featureToolName + "_SlidingLinearFitRMS");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -774,21 +680,9 @@ void ThreeDVertexDistanceFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDVertexDistanceFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDVertexDistanceFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
-
-    if (featureMap.find(featureToolName + "_VertexDistance") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_VertexDistance");
-
-    featureMap[featureToolName + "_VertexDistance"] = toolFeatureVec[0].Get();
+    featureNames.push_back(featureToolName + "_VertexDistance");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -855,21 +749,9 @@ void ThreeDOpeningAngleFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDOpeningAngleFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder,
-    const std::string &featureToolName, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDOpeningAngleFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
-
-    if (featureMap.find(featureToolName + "_AngleDiff") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_AngleDiff");
-
-    featureMap[featureToolName + "_AngleDiff"] = toolFeatureVec[0].Get();
+    featureNames.push_back(featureToolName + "_AngleDiff");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -1024,24 +906,10 @@ void ThreeDPCAFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDPCAFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDPCAFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
-
-    if (featureMap.find(featureToolName + "_SecondaryPCARatio") != featureMap.end() ||
-        featureMap.find(featureToolName + "_TertiaryPCARatio") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_SecondaryPCARatio");
-    featureOrder.push_back(featureToolName + "_TertiaryPCARatio");
-
-    featureMap[featureToolName + "_SecondaryPCARatio"] = toolFeatureVec[0].Get();
-    featureMap[featureToolName + "_TertiaryPCARatio"] = toolFeatureVec[1].Get();
+    featureNames.push_back(featureToolName + "_SecondaryPCARatio");
+    featureNames.push_back(featureToolName + "_TertiaryPCARatio");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -1087,24 +955,10 @@ void ThreeDChargeFeatureTool::Run(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeDChargeFeatureTool::Run(LArMvaHelper::MvaFeatureMap &featureMap, StringVector &featureOrder, const std::string &featureToolName,
-    const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo)
+void ThreeDChargeFeatureTool::GetFeatureNames(const std::string &featureToolName, StringVector &featureNames) const
 {
-    LArMvaHelper::MvaFeatureVector toolFeatureVec;
-    this->Run(toolFeatureVec, pAlgorithm, pInputPfo);
-
-    if (featureMap.find(featureToolName + "_FractionalSpread") != featureMap.end() ||
-        featureMap.find(featureToolName + "_EndFraction") != featureMap.end())
-    {
-        std::cout << "Already wrote this feature into map! Not writing again." << std::endl;
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-    }
-
-    featureOrder.push_back(featureToolName + "_FractionalSpread");
-    featureOrder.push_back(featureToolName + "_EndFraction");
-
-    featureMap[featureToolName + "_FractionalSpread"] = toolFeatureVec[0].Get();
-    featureMap[featureToolName + "_EndFraction"] = toolFeatureVec[1].Get();
+    featureNames.push_back(featureToolName + "_FractionalSpread");
+    featureNames.push_back(featureToolName + "_EndFraction");
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
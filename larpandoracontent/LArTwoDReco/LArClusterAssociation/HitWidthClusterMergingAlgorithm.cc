@@ -102,12 +102,18 @@ void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const Cluste
 bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, const Cluster *const pCurrentCluster, const Cluster *const pTestCluster) const
 {
     //ATTN - cannot use map since higherXExtrema may have changed during merging
-    const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector));
-    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector));
+    CartesianVector currentLowerXExtrema(0.f, 0.f, 0.f), currentHigherXExtrema(0.f, 0.f, 0.f);
+    m_constituentHitPositionVector.clear();
+    LArHitWidthHelper::GetConstituentHitPositions(
+        pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false, m_constituentHitPositionVector);
+    LArHitWidthHelper::GetExtremalCoordinatesX(m_constituentHitPositionVector, currentLowerXExtrema, currentHigherXExtrema);
+
+    CartesianVector testLowerXExtrema(0.f, 0.f, 0.f), testHigherXExtrema(0.f, 0.f, 0.f);
+    m_constituentHitPositionVector.clear();
+    LArHitWidthHelper::GetConstituentHitPositions(
+        pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false, m_constituentHitPositionVector);
+    LArHitWidthHelper::GetExtremalCoordinatesX(m_constituentHitPositionVector, testLowerXExtrema, testHigherXExtrema);
+
     float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
 
     if (isForward)
@@ -176,7 +182,10 @@ bool HitWidthClusterMergingAlgorithm::AreClustersAssociated(
         return false;
 
     // check that the new direction is consistent with the old clusters
-    LArHitWidthHelper::ConstituentHitVector newConstituentHitVector(currentFitParameters.GetConstituentHitVector());
+    LArHitWidthHelper::ConstituentHitVector newConstituentHitVector;
+    newConstituentHitVector.reserve(currentFitParameters.GetConstituentHitVector().size() + testFitParameters.GetConstituentHitVector().size());
+    newConstituentHitVector.insert(newConstituentHitVector.end(), currentFitParameters.GetConstituentHitVector().begin(),
+        currentFitParameters.GetConstituentHitVector().end());
     newConstituentHitVector.insert(newConstituentHitVector.end(), testFitParameters.GetConstituentHitVector().begin(),
         testFitParameters.GetConstituentHitVector().end());
 
@@ -330,7 +339,9 @@ void HitWidthClusterMergingAlgorithm::GetConstituentHitSubsetVector(const LArHit
 void HitWidthClusterMergingAlgorithm::GetFittingAxes(const LArHitWidthHelper::ConstituentHitVector &constituentHitSubsetVector,
     CartesianVector &axisDirection, CartesianVector &orthoDirection) const
 {
-    CartesianPointVector constituentHitSubsetPositionVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitSubsetVector));
+    CartesianPointVector &constituentHitSubsetPositionVector(m_constituentHitPositionVector);
+    constituentHitSubsetPositionVector.clear();
+    LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitSubsetVector, constituentHitSubsetPositionVector);
 
     if (constituentHitSubsetPositionVector.size() < 2)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
@@ -140,6 +140,7 @@ private:
 
     // ATTN Dangling pointers emerge during cluster merging, here explicitly not dereferenced
     mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap; ///< The map [cluster -> cluster parameters]
+    mutable pandora::CartesianPointVector m_constituentHitPositionVector;       ///< Constituent hit position storage, reused between calculations
 };
 
 } //namespace lar_content
@@ -141,13 +141,17 @@ void TransverseAssociationAlgorithm::GetNearbyClusterMap(const ClusterVector &al
         CaloHitList daughterHits;
         pCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
 
+        KDTreeBoxVector searchRegions;
+        searchRegions.reserve(daughterHits.size());
+
         for (const CaloHit *const pCaloHit : daughterHits)
-        {
-            KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegionX, m_searchRegionZ));
+            searchRegions.push_back(build_2d_kd_search_region(pCaloHit, m_searchRegionX, m_searchRegionZ));
 
-            HitKDNode2DList found;
-            kdTree.search(searchRegionHits, found);
+        std::vector<HitKDNode2DList> foundLists;
+        kdTree.search(searchRegions, foundLists);
 
+        for (const HitKDNode2DList &found : foundLists)
+        {
             for (const auto &hit : found)
                 (void)nearbyClusters[pCluster].insert(hitToClusterMap.at(hit.data));
         }
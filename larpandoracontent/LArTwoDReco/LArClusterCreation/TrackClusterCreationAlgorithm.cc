@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterCreation/TrackClusterCreationAlgorithm.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -36,19 +38,23 @@ StatusCode TrackClusterCreationAlgorithm::Run()
     OrderedCaloHitList selectedCaloHitList, rejectedCaloHitList;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FilterCaloHits(pCaloHitList, selectedCaloHitList, rejectedCaloHitList));
 
+    LayerSortedHitsMap selectedHitsMap, rejectedHitsMap;
+    this->SortLayerHits(selectedCaloHitList, selectedHitsMap);
+    this->SortLayerHits(rejectedCaloHitList, rejectedHitsMap);
+
     HitAssociationMap forwardHitAssociationMap, backwardHitAssociationMap;
-    this->MakePrimaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
-    this->MakeSecondaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
+    this->MakePrimaryAssociations(selectedHitsMap, forwardHitAssociationMap, backwardHitAssociationMap);
+    this->MakeSecondaryAssociations(selectedHitsMap, forwardHitAssociationMap, backwardHitAssociationMap);
 
     HitJoinMap hitJoinMap;
     HitToClusterMap hitToClusterMap;
-    this->IdentifyJoins(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap, hitJoinMap);
-    this->CreateClusters(selectedCaloHitList, hitJoinMap, hitToClusterMap);
+    this->IdentifyJoins(selectedHitsMap, forwardHitAssociationMap, backwardHitAssociationMap, hitJoinMap);
+    this->CreateClusters(selectedHitsMap, hitJoinMap, hitToClusterMap);
 
     if (!m_mergeBackFilteredHits)
-        this->CreateClusters(rejectedCaloHitList, hitJoinMap, hitToClusterMap);
+        this->CreateClusters(rejectedHitsMap, hitJoinMap, hitToClusterMap);
 
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->AddFilteredCaloHits(selectedCaloHitList, rejectedCaloHitList, hitToClusterMap));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->AddFilteredCaloHits(selectedHitsMap, rejectedHitsMap, hitToClusterMap));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -71,17 +77,23 @@ StatusCode TrackClusterCreationAlgorithm::FilterCaloHits(
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, selectedCaloHitList.Add(availableHitList));
 
+    const float minCaloHitSeparation(std::sqrt(m_minCaloHitSeparationSquared));
+    HitIndexVector hitIndices;
+
     for (OrderedCaloHitList::const_iterator iter = selectedCaloHitList.begin(), iterEnd = selectedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
+        const SortedHits sortedHits(*iter->second);
+        const CaloHitVector &caloHits(sortedHits.GetCaloHits());
 
         for (const CaloHit *const pCaloHitI : caloHits)
         {
             bool useCaloHit(true);
+            sortedHits.GetHitIndicesInWindow(pCaloHitI->GetPositionVector().GetX(), minCaloHitSeparation, hitIndices);
 
-            for (const CaloHit *const pCaloHitJ : caloHits)
+            for (const unsigned int hitIndexJ : hitIndices)
             {
+                const CaloHit *const pCaloHitJ(caloHits.at(hitIndexJ));
+
                 if (pCaloHitI == pCaloHitJ)
                     continue;
 
@@ -104,21 +116,31 @@ StatusCode TrackClusterCreationAlgorithm::FilterCaloHits(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrackClusterCreationAlgorithm::SortLayerHits(const OrderedCaloHitList &orderedCaloHitList, LayerSortedHitsMap &layerSortedHitsMap) const
+{
+    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+        (void)layerSortedHitsMap.insert(LayerSortedHitsMap::value_type(iter->first, SortedHits(*iter->second)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
-    const OrderedCaloHitList &selectedCaloHitList, const OrderedCaloHitList &rejectedCaloHitList, HitToClusterMap &hitToClusterMap) const
+    const LayerSortedHitsMap &selectedHitsMap, const LayerSortedHitsMap &rejectedHitsMap, HitToClusterMap &hitToClusterMap) const
 {
-    for (OrderedCaloHitList::const_iterator iter = rejectedCaloHitList.begin(), iterEnd = rejectedCaloHitList.end(); iter != iterEnd; ++iter)
+    const float minCaloHitSeparation(std::sqrt(m_minCaloHitSeparationSquared));
+    HitIndexVector hitIndices;
+
+    for (LayerSortedHitsMap::const_iterator iter = rejectedHitsMap.begin(), iterEnd = rejectedHitsMap.end(); iter != iterEnd; ++iter)
     {
-        CaloHitList *pCaloHitList = NULL;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, selectedCaloHitList.GetCaloHitsInPseudoLayer(iter->first, pCaloHitList));
+        LayerSortedHitsMap::const_iterator selectedIter = selectedHitsMap.find(iter->first);
 
-        CaloHitSet unavailableHits;
+        if (selectedHitsMap.end() == selectedIter)
+            return STATUS_CODE_NOT_FOUND;
 
-        CaloHitVector inputAvailableHits(iter->second->begin(), iter->second->end());
-        std::sort(inputAvailableHits.begin(), inputAvailableHits.end(), LArClusterHelper::SortHitsByPosition);
+        CaloHitSet unavailableHits;
 
-        CaloHitVector clusteredHits(pCaloHitList->begin(), pCaloHitList->end());
-        std::sort(clusteredHits.begin(), clusteredHits.end(), LArClusterHelper::SortHitsByPosition);
+        const CaloHitVector &inputAvailableHits(iter->second.GetCaloHits());
+        SortedHits clusteredHits(selectedIter->second);
 
         bool carryOn(true);
 
@@ -137,9 +159,12 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
 
                 const CaloHit *pClosestHit = NULL;
                 float closestSeparationSquared(m_minCaloHitSeparationSquared);
+                clusteredHits.GetHitIndicesInWindow(pCaloHitI->GetPositionVector().GetX(), minCaloHitSeparation, hitIndices);
 
-                for (const CaloHit *const pCaloHitJ : clusteredHits)
+                for (const unsigned int hitIndexJ : hitIndices)
                 {
+                    const CaloHit *const pCaloHitJ(clusteredHits.GetCaloHits().at(hitIndexJ));
+
                     if (pCaloHitI->GetMipEquivalentEnergy() > pCaloHitJ->GetMipEquivalentEnergy())
                         continue;
 
@@ -170,7 +195,7 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
 
             for (const CaloHit *const pCaloHit : newClusteredHits)
             {
-                clusteredHits.push_back(pCaloHit);
+                clusteredHits.Add(pCaloHit);
                 unavailableHits.insert(pCaloHit);
             }
         }
@@ -181,29 +206,33 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHitList &orderedCaloHitList,
+void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const LayerSortedHitsMap &layerSortedHitsMap,
     HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
-    for (OrderedCaloHitList::const_iterator iterI = orderedCaloHitList.begin(), iterIEnd = orderedCaloHitList.end(); iterI != iterIEnd; ++iterI)
+    const float maxCaloHitSeparation(std::sqrt(m_maxCaloHitSeparationSquared));
+    HitIndexVector hitIndices;
+
+    for (LayerSortedHitsMap::const_iterator iterI = layerSortedHitsMap.begin(), iterIEnd = layerSortedHitsMap.end(); iterI != iterIEnd; ++iterI)
     {
         unsigned int nLayersConsidered(0);
 
-        CaloHitVector caloHitsI(iterI->second->begin(), iterI->second->end());
-        std::sort(caloHitsI.begin(), caloHitsI.end(), LArClusterHelper::SortHitsByPosition);
+        const CaloHitVector &caloHitsI(iterI->second.GetCaloHits());
 
-        for (OrderedCaloHitList::const_iterator iterJ = iterI, iterJEnd = orderedCaloHitList.end();
+        for (LayerSortedHitsMap::const_iterator iterJ = iterI, iterJEnd = layerSortedHitsMap.end();
              (nLayersConsidered++ <= m_maxGapLayers + 1) && (iterJ != iterJEnd); ++iterJ)
         {
             if (iterJ->first == iterI->first || iterJ->first > iterI->first + m_maxGapLayers + 1)
                 continue;
 
-            CaloHitVector caloHitsJ(iterJ->second->begin(), iterJ->second->end());
-            std::sort(caloHitsJ.begin(), caloHitsJ.end(), LArClusterHelper::SortHitsByPosition);
+            const CaloHitVector &caloHitsJ(iterJ->second.GetCaloHits());
 
             for (const CaloHit *const pCaloHitI : caloHitsI)
             {
-                for (const CaloHit *const pCaloHitJ : caloHitsJ)
-                    this->CreatePrimaryAssociation(pCaloHitI, pCaloHitJ, forwardHitAssociationMap, backwardHitAssociationMap);
+                // Hits outside the x window cannot pass the separation cut; the remainder are visited in their usual order
+                iterJ->second.GetHitIndicesInWindow(pCaloHitI->GetPositionVector().GetX(), maxCaloHitSeparation, hitIndices);
+
+                for (const unsigned int hitIndexJ : hitIndices)
+                    this->CreatePrimaryAssociation(pCaloHitI, caloHitsJ.at(hitIndexJ), forwardHitAssociationMap, backwardHitAssociationMap);
             }
         }
     }
@@ -211,15 +240,12 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const OrderedCaloHitList &orderedCaloHitList,
+void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const LayerSortedHitsMap &layerSortedHitsMap,
     HitAssociationMap &forwardHitAssociationMap, HitAssociationMap &backwardHitAssociationMap) const
 {
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (LayerSortedHitsMap::const_iterator iter = layerSortedHitsMap.begin(), iterEnd = layerSortedHitsMap.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const CaloHit *const pCaloHit : iter->second.GetCaloHits())
         {
             HitAssociationMap::const_iterator fwdIter = forwardHitAssociationMap.find(pCaloHit);
             const CaloHit *const pForwardHit((forwardHitAssociationMap.end() == fwdIter) ? NULL : fwdIter->second.GetPrimaryTarget());
@@ -244,15 +270,12 @@ void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const OrderedCaloH
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::IdentifyJoins(const OrderedCaloHitList &orderedCaloHitList,
+void TrackClusterCreationAlgorithm::IdentifyJoins(const LayerSortedHitsMap &layerSortedHitsMap,
     const HitAssociationMap &forwardHitAssociationMap, const HitAssociationMap &backwardHitAssociationMap, HitJoinMap &hitJoinMap) const
 {
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (LayerSortedHitsMap::const_iterator iter = layerSortedHitsMap.begin(), iterEnd = layerSortedHitsMap.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const CaloHit *const pCaloHit : iter->second.GetCaloHits())
         {
             const CaloHit *const pForwardJoinHit = this->GetJoinHit(pCaloHit, forwardHitAssociationMap, backwardHitAssociationMap);
             const CaloHit *const pBackwardJoinHit = this->GetJoinHit(pForwardJoinHit, backwardHitAssociationMap, forwardHitAssociationMap);
@@ -274,14 +297,11 @@ void TrackClusterCreationAlgorithm::IdentifyJoins(const OrderedCaloHitList &orde
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TrackClusterCreationAlgorithm::CreateClusters(
-    const OrderedCaloHitList &orderedCaloHitList, const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const
+    const LayerSortedHitsMap &layerSortedHitsMap, const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const
 {
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (LayerSortedHitsMap::const_iterator iter = layerSortedHitsMap.begin(), iterEnd = layerSortedHitsMap.end(); iter != iterEnd; ++iter)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const CaloHit *const pCaloHit : iter->second.GetCaloHits())
         {
             const Cluster *pCluster = NULL;
 
@@ -438,6 +458,49 @@ const CaloHit *TrackClusterCreationAlgorithm::TraceHitAssociation(const CaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TrackClusterCreationAlgorithm::SortedHits::SortedHits(const CaloHitList &caloHitList) :
+    m_caloHits(caloHitList.begin(), caloHitList.end())
+{
+    std::sort(m_caloHits.begin(), m_caloHits.end(), LArClusterHelper::SortHitsByPosition);
+    m_xIndexVector.reserve(m_caloHits.size());
+
+    for (unsigned int hitIndex = 0; hitIndex < m_caloHits.size(); ++hitIndex)
+        m_xIndexVector.emplace_back(m_caloHits.at(hitIndex)->GetPositionVector().GetX(), hitIndex);
+
+    std::sort(m_xIndexVector.begin(), m_xIndexVector.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackClusterCreationAlgorithm::SortedHits::Add(const CaloHit *const pCaloHit)
+{
+    const CoordinateIndex coordinateIndex(pCaloHit->GetPositionVector().GetX(), m_caloHits.size());
+    m_xIndexVector.insert(std::upper_bound(m_xIndexVector.begin(), m_xIndexVector.end(), coordinateIndex), coordinateIndex);
+    m_caloHits.push_back(pCaloHit);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackClusterCreationAlgorithm::SortedHits::GetHitIndicesInWindow(const float x, const float halfWidth, HitIndexVector &hitIndices) const
+{
+    hitIndices.clear();
+
+    // Pad the window slightly, so that no hit is lost to rounding; callers apply their exact separation cuts to the returned hits
+    const float paddedHalfWidth(1.001f * halfWidth + 4.f * std::numeric_limits<float>::epsilon() * std::fabs(x));
+    const CoordinateIndex lowerBound(x - paddedHalfWidth, 0);
+
+    for (CoordinateIndexVector::const_iterator iter = std::lower_bound(m_xIndexVector.begin(), m_xIndexVector.end(), lowerBound),
+                                               iterEnd = m_xIndexVector.end();
+         (iter != iterEnd) && (iter->first <= x + paddedHalfWidth); ++iter)
+    {
+        hitIndices.push_back(iter->second);
+    }
+
+    std::sort(hitIndices.begin(), hitIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackClusterCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -10,6 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
+#include <map>
 #include <unordered_map>
 
 namespace lar_content
@@ -84,6 +85,53 @@ private:
         float m_secondaryDistanceSquared;           ///< the secondary distance squared
     };
 
+    typedef std::vector<unsigned int> HitIndexVector;
+
+    /**
+     *  @brief  SortedHits class, holding the hits in a single pseudo layer sorted by position, alongside an index sorted by x coordinate
+     */
+    class SortedHits
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  caloHitList the list of hits in the pseudo layer
+         */
+        SortedHits(const pandora::CaloHitList &caloHitList);
+
+        /**
+         *  @brief  Append a hit, which will be placed after all existing hits in the position-ordered vector
+         *
+         *  @param  pCaloHit address of the calo hit
+         */
+        void Add(const pandora::CaloHit *const pCaloHit);
+
+        /**
+         *  @brief  Get the hits, sorted by position (or, for hits appended later, in order of addition)
+         *
+         *  @return the hits
+         */
+        const pandora::CaloHitVector &GetCaloHits() const;
+
+        /**
+         *  @brief  Get the indices of all hits with x coordinate within a specified window, in order of the position-ordered hit vector
+         *
+         *  @param  x the window centre
+         *  @param  halfWidth the window half-width
+         *  @param  hitIndices to receive the indices of the hits in the window
+         */
+        void GetHitIndicesInWindow(const float x, const float halfWidth, HitIndexVector &hitIndices) const;
+
+    private:
+        typedef std::pair<float, unsigned int> CoordinateIndex;
+        typedef std::vector<CoordinateIndex> CoordinateIndexVector;
+
+        pandora::CaloHitVector m_caloHits;    ///< The hits, sorted by position
+        CoordinateIndexVector m_xIndexVector; ///< The x coordinates and hit indices, sorted by x coordinate
+    };
+
+    typedef std::map<unsigned int, SortedHits> LayerSortedHitsMap;
     typedef std::unordered_map<const pandora::CaloHit *, HitAssociation> HitAssociationMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::CaloHit *> HitJoinMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
@@ -101,55 +149,63 @@ private:
     pandora::StatusCode FilterCaloHits(const pandora::CaloHitList *const pCaloHitList, pandora::OrderedCaloHitList &selectedCaloHitList,
         pandora::OrderedCaloHitList &rejectedCaloHitList) const;
 
+    /**
+     *  @brief  Sort the hits in each pseudo layer of an ordered calo hit list, ready for use in the association and clustering steps
+     *
+     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  layerSortedHitsMap to receive the sorted hits for each pseudo layer
+     */
+    void SortLayerHits(const pandora::OrderedCaloHitList &orderedCaloHitList, LayerSortedHitsMap &layerSortedHitsMap) const;
+
     /**
      *  @brief  Merge previously filtered hits back into their associated clusters
      *
-     *  @param  selectedCaloHitList the ordered list of selected hits
-     *  @param  rejectedCaloHitList the ordered list of rejected hits
+     *  @param  selectedHitsMap the sorted selected hits for each pseudo layer
+     *  @param  rejectedHitsMap the sorted rejected hits for each pseudo layer
      *  @param  hitToClusterMap the mapping between hits and their clusters
      */
-    pandora::StatusCode AddFilteredCaloHits(const pandora::OrderedCaloHitList &selectedCaloHitList,
-        const pandora::OrderedCaloHitList &rejectedCaloHitList, HitToClusterMap &hitToClusterMap) const;
+    pandora::StatusCode AddFilteredCaloHits(
+        const LayerSortedHitsMap &selectedHitsMap, const LayerSortedHitsMap &rejectedHitsMap, HitToClusterMap &hitToClusterMap) const;
 
     /**
      *  @brief  Control primary association formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  layerSortedHitsMap the sorted hits for each pseudo layer
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakePrimaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
+    void MakePrimaryAssociations(const LayerSortedHitsMap &layerSortedHitsMap, HitAssociationMap &forwardHitAssociationMap,
         HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Control secondary association formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  layerSortedHitsMap the sorted hits for each pseudo layer
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakeSecondaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
+    void MakeSecondaryAssociations(const LayerSortedHitsMap &layerSortedHitsMap, HitAssociationMap &forwardHitAssociationMap,
         HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Identify final hit joins for use in cluster formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  layerSortedHitsMap the sorted hits for each pseudo layer
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      *  @param  hitJoinMap to receive the hit join map
      */
-    void IdentifyJoins(const pandora::OrderedCaloHitList &orderedCaloHitList, const HitAssociationMap &forwardHitAssociationMap,
+    void IdentifyJoins(const LayerSortedHitsMap &layerSortedHitsMap, const HitAssociationMap &forwardHitAssociationMap,
         const HitAssociationMap &backwardHitAssociationMap, HitJoinMap &hitJoinMap) const;
 
     /**
      *  @brief  Final cluster formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  layerSortedHitsMap the sorted hits for each pseudo layer
      *  @param  hitJoinMap the hit join map
      *  @param  hitToClusterMap the mapping between hits and their clusters
      */
-    void CreateClusters(const pandora::OrderedCaloHitList &orderedCaloHitList, const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const;
+    void CreateClusters(const LayerSortedHitsMap &layerSortedHitsMap, const HitJoinMap &hitJoinMap, HitToClusterMap &hitToClusterMap) const;
 
     /**
      *  @brief  Create primary association if appropriate, hitI<->hitJ
@@ -207,6 +263,13 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline const pandora::CaloHitVector &TrackClusterCreationAlgorithm::SortedHits::GetCaloHits() const
+{
+    return m_caloHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline TrackClusterCreationAlgorithm::HitAssociation::HitAssociation(const pandora::CaloHit *const pPrimaryTarget, const float primaryDistanceSquared) :
     m_pPrimaryTarget(pPrimaryTarget),
     m_pSecondaryTarget(NULL),
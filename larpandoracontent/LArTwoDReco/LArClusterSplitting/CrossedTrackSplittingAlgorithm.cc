@@ -57,13 +57,17 @@ StatusCode CrossedTrackSplittingAlgorithm::PreparationStep(const ClusterVector &
         CaloHitList daughterHits;
         pCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
 
+        KDTreeBoxVector searchRegions;
+        searchRegions.reserve(daughterHits.size());
+
         for (const CaloHit *const pCaloHit : daughterHits)
-        {
-            KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
+            searchRegions.push_back(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
 
-            HitKDNode2DList found;
-            kdTree.search(searchRegionHits, found);
+        std::vector<HitKDNode2DList> foundLists;
+        kdTree.search(searchRegions, foundLists);
 
+        for (const HitKDNode2DList &found : foundLists)
+        {
             for (const auto &hit : found)
                 (void)m_nearbyClusters[pCluster].insert(hitToClusterMap.at(hit.data));
         }
@@ -0,0 +1,141 @@
+/**
+ *  @file   larpandoracontent/LArUtility/AlgorithmProfiler.cc
+ *
+ *  @brief  Implementation of the algorithm profiler class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArUtility/AlgorithmProfiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include <sys/resource.h>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+std::mutex AlgorithmProfiler::m_fileMutex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfiler::ScopedMeasurement::ScopedMeasurement(AlgorithmProfiler *const pAlgorithmProfiler, const std::string &name) :
+    m_pAlgorithmProfiler(pAlgorithmProfiler),
+    m_name(pAlgorithmProfiler ? name : std::string()),
+    m_startTime(pAlgorithmProfiler ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()),
+    m_startProcessPeakRss(pAlgorithmProfiler ? AlgorithmProfiler::GetProcessPeakRss() : 0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfiler::ScopedMeasurement::~ScopedMeasurement()
+{
+    if (!m_pAlgorithmProfiler)
+        return;
+
+    const std::chrono::duration<double> wallTime(std::chrono::steady_clock::now() - m_startTime);
+    m_pAlgorithmProfiler->Record(m_name, wallTime.count(), AlgorithmProfiler::GetProcessPeakRss() - m_startProcessPeakRss);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfiler::AlgorithmProfiler(const std::string &instanceLabel, const std::string &outputFileName) :
+    m_instanceLabel(instanceLabel),
+    m_outputFileName(outputFileName),
+    m_nEventsBegun(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AlgorithmProfiler::Record(const std::string &name, const double wallTime, const long processPeakRssIncrease)
+{
+    NameToRecordIndexMap::const_iterator iter(m_nameToRecordIndexMap.find(name));
+
+    if (m_nameToRecordIndexMap.end() == iter)
+    {
+        iter = m_nameToRecordIndexMap.insert(NameToRecordIndexMap::value_type(name, m_callRecordVector.size())).first;
+        m_callRecordVector.push_back(CallRecord(name));
+    }
+
+    CallRecord &callRecord(m_callRecordVector.at(iter->second));
+    ++callRecord.m_nCalls;
+    callRecord.m_wallTime += wallTime;
+    callRecord.m_processPeakRssIncrease = std::max(callRecord.m_processPeakRssIncrease, processPeakRssIncrease);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AlgorithmProfiler::BeginEvent()
+{
+    ++m_nEventsBegun;
+    m_callRecordVector.clear();
+    m_nameToRecordIndexMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AlgorithmProfiler::WriteEvent()
+{
+    if (0 == m_nEventsBegun)
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_fileMutex);
+
+        const bool isNewFile(!std::ifstream(m_outputFileName).good() || (0 == std::ifstream(m_outputFileName, std::ios::ate).tellg()));
+        std::ofstream outputFile(m_outputFileName, std::ios::app);
+
+        if (!outputFile.good())
+        {
+            std::cout << "AlgorithmProfiler: unable to open output file " << m_outputFileName << std::endl;
+            return STATUS_CODE_FAILURE;
+        }
+
+        if (isNewFile)
+            outputFile << "event,instance,name,calls,wallTimeSeconds,processPeakRssIncreaseKB" << std::endl;
+
+        for (const CallRecord &callRecord : m_callRecordVector)
+        {
+            outputFile << (m_nEventsBegun - 1) << "," << m_instanceLabel << "," << callRecord.m_name << "," << callRecord.m_nCalls << ","
+                       << callRecord.m_wallTime << "," << callRecord.m_processPeakRssIncrease << std::endl;
+        }
+    }
+
+    m_callRecordVector.clear();
+    m_nameToRecordIndexMap.clear();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+long AlgorithmProfiler::GetProcessPeakRss()
+{
+    // ATTN The peak resident set size is a process-wide high-water mark, so an increase is attributed to all calls active at the time
+    struct rusage resourceUsage;
+
+    if (0 != getrusage(RUSAGE_SELF, &resourceUsage))
+        return 0;
+
+    return resourceUsage.ru_maxrss;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfiler::CallRecord::CallRecord(const std::string &name) :
+    m_name(name),
+    m_nCalls(0),
+    m_wallTime(0.),
+    m_processPeakRssIncrease(0)
+{
+}
+
+} // namespace lar_content
@@ -0,0 +1,123 @@
+/**
+ *  @file   larpandoracontent/LArUtility/AlgorithmProfiler.h
+ *
+ *  @brief  Header file for the algorithm profiler class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_ALGORITHM_PROFILER_H
+#define LAR_ALGORITHM_PROFILER_H 1
+
+#include "Pandora/StatusCodes.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  AlgorithmProfiler class, recording the wall time, number of calls and increase in the process peak resident set size for
+ *          each named algorithm, tool or worker instance run during an event, and appending the records for each event to an output file
+ */
+class AlgorithmProfiler
+{
+public:
+    /**
+     *  @brief  ScopedMeasurement class, recording a single call to the profiler on destruction
+     */
+    class ScopedMeasurement
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pAlgorithmProfiler address of the algorithm profiler, or nullptr if profiling is disabled
+         *  @param  name the name of the algorithm, tool or worker instance being called
+         */
+        ScopedMeasurement(AlgorithmProfiler *const pAlgorithmProfiler, const std::string &name);
+
+        /**
+         *  @brief  Destructor
+         */
+        ~ScopedMeasurement();
+
+    private:
+        AlgorithmProfiler *const m_pAlgorithmProfiler;           ///< Address of the algorithm profiler, nullptr if profiling is disabled
+        const std::string m_name;                                ///< The name of the algorithm, tool or worker instance being called
+        const std::chrono::steady_clock::time_point m_startTime; ///< The time at the start of the call
+        const long m_startProcessPeakRss;                        ///< The process peak resident set size at the start of the call
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  instanceLabel the label identifying the profiled pandora instance in the output file
+     *  @param  outputFileName the name of the output file, to which records for each event are appended
+     */
+    AlgorithmProfiler(const std::string &instanceLabel, const std::string &outputFileName);
+
+    /**
+     *  @brief  Record a single call
+     *
+     *  @param  name the name of the algorithm, tool or worker instance called
+     *  @param  wallTime the wall time for the call, in seconds
+     *  @param  processPeakRssIncrease the increase in the process peak resident set size during the call, in kB
+     */
+    void Record(const std::string &name, const double wallTime, const long processPeakRssIncrease);
+
+    /**
+     *  @brief  Begin a new event, discarding any records left by a previous event whose processing failed before they were written
+     */
+    void BeginEvent();
+
+    /**
+     *  @brief  Append the records for the current event to the output file and reset them, ready for the next event
+     */
+    pandora::StatusCode WriteEvent();
+
+    /**
+     *  @brief  Get the process peak resident set size, a high-water mark shared by all threads
+     *
+     *  @return the process peak resident set size, in kB
+     */
+    static long GetProcessPeakRss();
+
+private:
+    /**
+     *  @brief  CallRecord class, accumulating the calls for a single name during an event
+     */
+    class CallRecord
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  name the name of the algorithm, tool or worker instance
+         */
+        CallRecord(const std::string &name);
+
+        std::string m_name;            ///< The name of the algorithm, tool or worker instance
+        unsigned int m_nCalls;         ///< The number of calls
+        double m_wallTime;             ///< The total wall time for all calls, in seconds
+        long m_processPeakRssIncrease; ///< The largest increase in the process peak resident set size during a single call, in kB
+    };
+
+    typedef std::vector<CallRecord> CallRecordVector;
+    typedef std::unordered_map<std::string, unsigned int> NameToRecordIndexMap;
+
+    const std::string m_instanceLabel;           ///< The label identifying the profiled pandora instance in the output file
+    const std::string m_outputFileName;          ///< The name of the output file
+    unsigned int m_nEventsBegun;                 ///< The number of events begun, including any discarded, so event numbers stay aligned
+    CallRecordVector m_callRecordVector;         ///< The call records for the current event, in order of first call
+    NameToRecordIndexMap m_nameToRecordIndexMap; ///< Map from name to position in the call record vector
+
+    static std::mutex m_fileMutex; ///< The mutex serialising writes from all profilers, which may share an output file
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_ALGORITHM_PROFILER_H
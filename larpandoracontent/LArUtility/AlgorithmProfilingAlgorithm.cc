@@ -0,0 +1,57 @@
+/**
+ *  @file   larpandoracontent/LArUtility/AlgorithmProfilingAlgorithm.cc
+ *
+ *  @brief  Implementation of the algorithm profiling algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArUtility/AlgorithmProfilingAlgorithm.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+StatusCode AlgorithmProfilingAlgorithm::Run()
+{
+    if (!m_pAlgorithmProfiler)
+    {
+        // ATTN Worker instances for different tpcs share settings files, so distinguish them by the volume id of their single tpc
+        const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
+        const std::string volumeLabel((1 == larTPCMap.size()) ? "_" + std::to_string(larTPCMap.begin()->second->GetLArTPCVolumeId()) : "");
+        m_pAlgorithmProfiler = std::make_unique<AlgorithmProfiler>(m_instanceLabel + volumeLabel, m_outputFileName);
+    }
+
+    m_pAlgorithmProfiler->BeginEvent();
+
+    {
+        const AlgorithmProfiler::ScopedMeasurement totalMeasurement(m_pAlgorithmProfiler.get(), this->GetInstanceName());
+
+        for (const std::string &algorithmName : m_algorithmNames)
+        {
+            const AlgorithmProfiler::ScopedMeasurement measurement(m_pAlgorithmProfiler.get(), algorithmName);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, algorithmName));
+        }
+    }
+
+    return m_pAlgorithmProfiler->WriteEvent();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AlgorithmProfilingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, "Algorithms", m_algorithmNames));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputFileName", m_outputFileName));
+
+    m_instanceLabel = this->GetInstanceName();
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InstanceLabel", m_instanceLabel));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,38 @@
+/**
+ *  @file   larpandoracontent/LArUtility/AlgorithmProfilingAlgorithm.h
+ *
+ *  @brief  Header file for the algorithm profiling algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_ALGORITHM_PROFILING_ALGORITHM_H
+#define LAR_ALGORITHM_PROFILING_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArUtility/AlgorithmProfiler.h"
+
+#include <memory>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  AlgorithmProfilingAlgorithm class, running a list of daughter algorithms and recording the wall time, number of calls and
+ *          increase in the process peak resident set size during each, with the records for each event appended to an output file
+ */
+class AlgorithmProfilingAlgorithm : public pandora::Algorithm
+{
+private:
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    pandora::StringVector m_algorithmNames;                  ///< The ordered list of daughter algorithms to run
+    std::string m_outputFileName;                            ///< The name of the output file, to which records are appended
+    std::string m_instanceLabel;                             ///< The label identifying this instance in the output file
+    std::unique_ptr<AlgorithmProfiler> m_pAlgorithmProfiler; ///< The algorithm profiler, created when the first event is processed
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_ALGORITHM_PROFILING_ALGORITHM_H
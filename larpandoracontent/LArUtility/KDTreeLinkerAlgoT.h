@@ -10,6 +10,10 @@
 
 #include "KDTreeLinkerToolsT.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
 #include <vector>
 
 namespace lar_content
@@ -17,6 +21,9 @@ namespace lar_content
 
 /**
  *  @brief  Class that implements the KDTree partition of 2D space and a closest point search algorithm
+ *
+ *          The nodes are held in a single array, in depth-first order. Queries do not modify the tree, so a built tree may be searched
+ *          from several threads at once, provided it is not rebuilt or cleared meanwhile.
  */
 template <typename DATA, unsigned DIM = 2>
 class KDTreeLinkerAlgo
@@ -47,7 +54,16 @@ public:
      *  @param  searchBox
      *  @param  resRecHitList
      */
-    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList);
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  Search in the KDTree for all points that would be contained in each of the given searchboxes
+     *
+     *  @param  searchBoxes
+     *  @param  resRecHitLists to receive the founded points for each searchbox, in searchbox order
+     */
+    void search(
+        const std::vector<KDTreeBoxT<DIM>> &searchBoxes, std::vector<std::vector<KDTreeNodeInfoT<DATA, DIM>>> &resRecHitLists) const;
 
     /**
      *  @brief  findNearestNeighbour
@@ -56,21 +72,52 @@ public:
      *  @param  result
      *  @param  distance
      */
-    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance);
+    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const;
+
+    /**
+     *  @brief  Find the k points closest to a given point
+     *
+     *  @param  point
+     *  @param  k the maximum number of points to find
+     *  @param  results to receive the addresses of the closest points, in order of increasing distance
+     *  @param  distances to receive the distances to the closest points
+     */
+    void findKNearestNeighbours(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k,
+        std::vector<const KDTreeNodeInfoT<DATA, DIM> *> &results, std::vector<float> &distances) const;
+
+    /**
+     *  @brief  Find all points within a given distance of a given point
+     *
+     *  @param  point
+     *  @param  radius
+     *  @param  resRecHitList to receive the founded points
+     */
+    void findNeighboursWithinRadius(
+        const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  Find all points within a given distance of each of the given points
+     *
+     *  @param  points
+     *  @param  radius
+     *  @param  resRecHitLists to receive the founded points for each given point, in point order
+     */
+    void findNeighboursWithinRadius(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &points, const float radius,
+        std::vector<std::vector<KDTreeNodeInfoT<DATA, DIM>>> &resRecHitLists) const;
 
     /**
      *  @brief  Whether the tree is empty
      *
      *  @return boolean
      */
-    bool empty();
+    bool empty() const;
 
     /**
      *  @brief  Return the number of nodes + leaves in the tree (nElements should be (size() +1) / 2)
      *
      *  @return the number of nodes + leaves in the tree
      */
-    int size();
+    int size() const;
 
     /**
      *  @brief  Clear all allocated structures
@@ -78,39 +125,41 @@ public:
     void clear();
 
 private:
-    /**
-     *  @brief  Get the next node from the node pool
-     *
-     *  @return the next node from the node pool
-     */
-    KDTreeNodeT<DATA, DIM> *getNextNode();
+    typedef std::vector<KDTreeNodeT<DATA, DIM>> NodeVector;
+    typedef std::pair<float, int> DistanceIndexPair;
+    typedef std::priority_queue<DistanceIndexPair> DistanceIndexQueue;
 
     /**
      *  @brief  Fast median search with Wirth algorithm in eltList between low and high indexes.
      *
+     *  @param  eltList
      *  @param  low
      *  @param  high
      *  @param  treeDepth
      */
-    int medianSearch(int low, int high, int treeDepth);
+    int medianSearch(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int treeDepth) const;
 
     /**
      *  @brief  Recursive kdtree builder. Is called by build()
      *
+     *  @param  eltList
      *  @param  low
      *  @param  high
      *  @param  depth
      *  @param  region
+     *
+     *  @return the index of the new node
      */
-    KDTreeNodeT<DATA, DIM> *recBuild(int low, int high, int depth, const KDTreeBoxT<DIM> &region);
+    int recBuild(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int depth, const KDTreeBoxT<DIM> &region);
 
     /**
      *  @brief  Recursive kdtree search. Is called by search()
      *
      *  @param  current
      *  @param  trackBox
+     *  @param  recHits
      */
-    void recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox);
+    void recSearch(const int current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
@@ -121,15 +170,49 @@ private:
      *  @param  best_match
      *  @param  best_dist
      */
-    void recNearestNeighbour(unsigned depth, const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
-        const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist);
+    void recNearestNeighbour(
+        unsigned depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point, int &best_match, float &best_dist) const;
+
+    /**
+     *  @brief  Recursive k nearest neighbours search. Is called by findKNearestNeighbours()
+     *
+     *  @param  depth
+     *  @param  current
+     *  @param  point
+     *  @param  k
+     *  @param  bestMatches the queue of best matches, with the furthest match at the top
+     */
+    void recKNearestNeighbours(unsigned depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k,
+        DistanceIndexQueue &bestMatches) const;
+
+    /**
+     *  @brief  Recursive fixed radius search. Is called by findNeighboursWithinRadius()
+     *
+     *  @param  depth
+     *  @param  current
+     *  @param  point
+     *  @param  radius
+     *  @param  recHits
+     */
+    void recRadiusSearch(unsigned depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point, const float radius,
+        std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  Add all elements of an subtree to the closest elements. Used during the recSearch().
      *
      *  @param  current
+     *  @param  recHits
      */
-    void addSubtree(const KDTreeNodeT<DATA, DIM> *current);
+    void addSubtree(const int current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
+
+    /**
+     *  @brief  Whether a node is a leaf
+     *
+     *  @param  node
+     *
+     *  @return boolean
+     */
+    bool isLeaf(const KDTreeNodeT<DATA, DIM> &node) const;
 
     /**
      *  @brief  dist2
@@ -141,31 +224,14 @@ private:
      */
     float dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const;
 
-    /**
-     *  @brief  Frees the KDTree.
-     */
-    void clearTree();
-
-    KDTreeNodeT<DATA, DIM> *root_;     ///< The KDTree root
-    KDTreeNodeT<DATA, DIM> *nodePool_; ///< Node pool allows us to do just 1 call to new for each tree building
-    int nodePoolSize_;                 ///< The node pool size
-    int nodePoolPos_;                  ///< The node pool position
-
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *closestNeighbour; ///< The closest neighbour
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList;   ///< The initial element list
+    NodeVector nodes_; ///< The tree nodes, in depth-first order, with the root first
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
-    root_(nullptr),
-    nodePool_(nullptr),
-    nodePoolSize_(-1),
-    nodePoolPos_(-1),
-    closestNeighbour(nullptr),
-    initialEltList(nullptr)
+inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo()
 {
 }
 
@@ -182,24 +248,24 @@ inline KDTreeLinkerAlgo<DATA, DIM>::~KDTreeLinkerAlgo()
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::build(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const KDTreeBoxT<DIM> &region)
 {
+    this->clear();
+
     if (eltList.size())
     {
-        initialEltList = &eltList;
-        const size_t mysize = initialEltList->size();
-
-        nodePoolSize_ = mysize * 2 - 1;
-        nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
+        // The tree size is exactly 2 * nbrElts - 1, so the node array is allocated just once
+        const size_t mysize = eltList.size();
+        nodes_.reserve(mysize * 2 - 1);
 
         // Here we build the KDTree
-        root_ = this->recBuild(0, mysize, 0, region);
-        initialEltList = nullptr;
+        (void)this->recBuild(eltList, 0, mysize, 0, region);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int treeDepth)
+inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int treeDepth) const
 {
     // We should have at least 1 element to calculate the median...
     //assert(low < high);
@@ -213,7 +279,7 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 
     while (l < m)
     {
-        KDTreeNodeInfoT<DATA, DIM> elt = (*initialEltList)[median];
+        KDTreeNodeInfoT<DATA, DIM> elt = eltList[median];
         int i = l;
         int j = m;
 
@@ -221,14 +287,14 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
         {
             // The even depth is associated to dim1 dimension, the odd one to dim2 dimension
             const unsigned thedim = treeDepth % DIM;
-            while ((*initialEltList)[i].dims[thedim] < elt.dims[thedim])
+            while (eltList[i].dims[thedim] < elt.dims[thedim])
                 ++i;
-            while ((*initialEltList)[j].dims[thedim] > elt.dims[thedim])
+            while (eltList[j].dims[thedim] > elt.dims[thedim])
                 --j;
 
             if (i <= j)
             {
-                std::swap((*initialEltList)[i], (*initialEltList)[j]);
+                std::swap(eltList[i], eltList[j]);
                 i++;
                 j--;
             }
@@ -246,27 +312,34 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits)
+inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
-    if (root_)
-    {
-        closestNeighbour = &recHits;
-        this->recSearch(root_, trackBox);
-        closestNeighbour = nullptr;
-    }
+    if (!nodes_.empty())
+        this->recSearch(0, trackBox, recHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox)
+inline void KDTreeLinkerAlgo<DATA, DIM>::search(
+    const std::vector<KDTreeBoxT<DIM>> &trackBoxes, std::vector<std::vector<KDTreeNodeInfoT<DATA, DIM>>> &recHitLists) const
 {
-    // By construction, current can't be null
-    //assert(current != 0);
-    // By Construction, a node can't have just 1 son.
-    //assert (!(((current->left == 0) && (current->right != 0)) || ((current->left != 0) && (current->right == 0))));
+    recHitLists.resize(trackBoxes.size());
+
+    for (size_t i = 0; i < trackBoxes.size(); ++i)
+        this->search(trackBoxes[i], recHitLists[i]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    if ((current->left == nullptr) && (current->right == nullptr))
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(
+    const int current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    // By construction, a node can't have just 1 son.
+    const KDTreeNodeT<DATA, DIM> &node(nodes_[current]);
+
+    if (this->isLeaf(node))
     {
         // Leaf case
         // If point inside the rectangle/area
@@ -274,56 +347,38 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         for (unsigned i = 0; i < DIM; ++i)
         {
-            const auto thedim = current->info.dims[i];
+            const auto thedim = node.info.dims[i];
             isInside = isInside && thedim >= trackBox.dimmin[i] && thedim <= trackBox.dimmax[i];
         }
 
         if (isInside)
-            closestNeighbour->push_back(current->info);
+            recHits.push_back(node.info);
     }
     else
     {
         // Node case
-        // If region( v->left ) is fully contained in the rectangle
-        bool isFullyContained = true;
-        bool hasIntersection = true;
-
-        for (unsigned i = 0; i < DIM; ++i)
-        {
-            const auto regionmin = current->left->region.dimmin[i];
-            const auto regionmax = current->left->region.dimmax[i];
-            isFullyContained = isFullyContained && (regionmin >= trackBox.dimmin[i] && regionmax <= trackBox.dimmax[i]);
-            hasIntersection = hasIntersection && (regionmin < trackBox.dimmax[i] && regionmax > trackBox.dimmin[i]);
-        }
-
-        if (isFullyContained)
-        {
-            this->addSubtree(current->left);
-        }
-        else if (hasIntersection)
+        for (const int son : {node.left, node.right})
         {
-            this->recSearch(current->left, trackBox);
-        }
-
-        //if region( v->right ) is fully contained in the rectangle
-        isFullyContained = true;
-        hasIntersection = true;
+            // If region( son ) is fully contained in the rectangle
+            bool isFullyContained = true;
+            bool hasIntersection = true;
 
-        for (unsigned i = 0; i < DIM; ++i)
-        {
-            const auto regionmin = current->right->region.dimmin[i];
-            const auto regionmax = current->right->region.dimmax[i];
-            isFullyContained = isFullyContained && (regionmin >= trackBox.dimmin[i] && regionmax <= trackBox.dimmax[i]);
-            hasIntersection = hasIntersection && (regionmin < trackBox.dimmax[i] && regionmax > trackBox.dimmin[i]);
-        }
+            for (unsigned i = 0; i < DIM; ++i)
+            {
+                const auto regionmin = nodes_[son].region.dimmin[i];
+                const auto regionmax = nodes_[son].region.dimmax[i];
+                isFullyContained = isFullyContained && (regionmin >= trackBox.dimmin[i] && regionmax <= trackBox.dimmax[i]);
+                hasIntersection = hasIntersection && (regionmin < trackBox.dimmax[i] && regionmax > trackBox.dimmin[i]);
+            }
 
-        if (isFullyContained)
-        {
-            this->addSubtree(current->right);
-        }
-        else if (hasIntersection)
-        {
-            this->recSearch(current->right, trackBox);
+            if (isFullyContained)
+            {
+                this->addSubtree(son, recHits);
+            }
+            else if (hasIntersection)
+            {
+                this->recSearch(son, trackBox, recHits);
+            }
         }
     }
 }
@@ -332,22 +387,19 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance)
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const
 {
-    if (nullptr != result || distance != std::numeric_limits<float>::max())
-    {
-        result = nullptr;
-        distance = std::numeric_limits<float>::max();
-    }
+    result = nullptr;
+    distance = std::numeric_limits<float>::max();
 
-    if (root_)
+    if (!nodes_.empty())
     {
-        const KDTreeNodeT<DATA, DIM> *best_match = nullptr;
-        this->recNearestNeighbour(0, root_, point, best_match, distance);
+        int best_match = -1;
+        this->recNearestNeighbour(0, 0, point, best_match, distance);
 
         if (distance != std::numeric_limits<float>::max())
         {
-            result = &(best_match->info);
+            result = &(nodes_[best_match].info);
             distance = std::sqrt(distance);
         }
     }
@@ -356,32 +408,33 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth, const KDTreeNodeT<DATA, DIM> *current,
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist)
+inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(
+    unsigned int depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point, int &best_match, float &best_dist) const
 {
     const unsigned int current_dim = depth % DIM;
+    const KDTreeNodeT<DATA, DIM> &node(nodes_[current]);
 
-    if (current->left == nullptr && current->right == nullptr)
+    if (this->isLeaf(node))
     {
         best_match = current;
-        best_dist = this->dist2(point, best_match->info);
+        best_dist = this->dist2(point, node.info);
         return;
     }
     else
     {
-        const float dist_to_axis = point.dims[current_dim] - current->info.dims[current_dim];
+        const float dist_to_axis = point.dims[current_dim] - node.info.dims[current_dim];
 
         if (dist_to_axis < 0.f)
         {
-            this->recNearestNeighbour(depth + 1, current->left, point, best_match, best_dist);
+            this->recNearestNeighbour(depth + 1, node.left, point, best_match, best_dist);
         }
         else
         {
-            this->recNearestNeighbour(depth + 1, current->right, point, best_match, best_dist);
+            this->recNearestNeighbour(depth + 1, node.right, point, best_match, best_dist);
         }
 
         // If we're here we're returned so best_dist is filled. Compare to this node and see if it's a better match. If it is, update result
-        const float dist_current = this->dist2(point, current->info);
+        const float dist_current = this->dist2(point, node.info);
 
         if (dist_current < best_dist)
         {
@@ -393,16 +446,16 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
         if (best_dist > dist_to_axis * dist_to_axis)
         {
             // if it does we traverse the other side of the axis to check for a new best
-            const KDTreeNodeT<DATA, DIM> *check_best = best_match;
+            int check_best = best_match;
             float check_dist = best_dist;
 
             if (dist_to_axis < 0.f)
             {
-                this->recNearestNeighbour(depth + 1, current->right, point, check_best, check_dist);
+                this->recNearestNeighbour(depth + 1, node.right, point, check_best, check_dist);
             }
             else
             {
-                this->recNearestNeighbour(depth + 1, current->left, point, check_best, check_dist);
+                this->recNearestNeighbour(depth + 1, node.left, point, check_best, check_dist);
             }
 
             if (check_dist < best_dist)
@@ -418,124 +471,219 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current)
+inline void KDTreeLinkerAlgo<DATA, DIM>::findKNearestNeighbours(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k,
+    std::vector<const KDTreeNodeInfoT<DATA, DIM> *> &results, std::vector<float> &distances) const
 {
-    // By construction, current can't be null
-    //assert(current != 0);
+    results.clear();
+    distances.clear();
 
-    if ((current->left == nullptr) && (current->right == nullptr))
+    if (nodes_.empty() || (0 == k))
+        return;
+
+    DistanceIndexQueue bestMatches;
+    this->recKNearestNeighbours(0, 0, point, k, bestMatches);
+
+    results.resize(bestMatches.size());
+    distances.resize(bestMatches.size());
+
+    // The queue yields the furthest match first, so fill the output from the back
+    for (size_t i = bestMatches.size(); i > 0; --i)
     {
-        // Leaf case
-        closestNeighbour->push_back(current->info);
+        results[i - 1] = &(nodes_[bestMatches.top().second].info);
+        distances[i - 1] = std::sqrt(bestMatches.top().first);
+        bestMatches.pop();
     }
-    else
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recKNearestNeighbours(unsigned depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point,
+    const unsigned int k, DistanceIndexQueue &bestMatches) const
+{
+    const KDTreeNodeT<DATA, DIM> &node(nodes_[current]);
+
+    if (this->isLeaf(node))
     {
-        // Node case
-        this->addSubtree(current->left);
-        this->addSubtree(current->right);
+        const float dist_current = this->dist2(point, node.info);
+
+        if (bestMatches.size() < k)
+        {
+            bestMatches.push(DistanceIndexPair(dist_current, current));
+        }
+        else if (dist_current < bestMatches.top().first)
+        {
+            bestMatches.pop();
+            bestMatches.push(DistanceIndexPair(dist_current, current));
+        }
+
+        return;
     }
+
+    // ATTN Only leaves are collected, as each node also holds a copy of the median leaf below it
+    const unsigned int current_dim = depth % DIM;
+    const float dist_to_axis = point.dims[current_dim] - node.info.dims[current_dim];
+    const int near_son = (dist_to_axis < 0.f) ? node.left : node.right;
+    const int far_son = (dist_to_axis < 0.f) ? node.right : node.left;
+
+    this->recKNearestNeighbours(depth + 1, near_son, point, k, bestMatches);
+
+    if ((bestMatches.size() < k) || (bestMatches.top().first > dist_to_axis * dist_to_axis))
+        this->recKNearestNeighbours(depth + 1, far_son, point, k, bestMatches);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const
+inline void KDTreeLinkerAlgo<DATA, DIM>::findNeighboursWithinRadius(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
-    double d = 0.;
+    if (!nodes_.empty())
+        this->recRadiusSearch(0, 0, point, radius, recHits);
+}
 
-    for (unsigned i = 0; i < DIM; ++i)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::findNeighboursWithinRadius(const std::vector<KDTreeNodeInfoT<DATA, DIM>> &points,
+    const float radius, std::vector<std::vector<KDTreeNodeInfoT<DATA, DIM>>> &recHitLists) const
+{
+    recHitLists.resize(points.size());
+
+    for (size_t i = 0; i < points.size(); ++i)
+        this->findNeighboursWithinRadius(points[i], radius, recHitLists[i]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recRadiusSearch(unsigned depth, const int current, const KDTreeNodeInfoT<DATA, DIM> &point,
+    const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    const KDTreeNodeT<DATA, DIM> &node(nodes_[current]);
+
+    if (this->isLeaf(node))
     {
-        const double diff = a.dims[i] - b.dims[i];
-        d += diff * diff;
+        if (this->dist2(point, node.info) <= radius * radius)
+            recHits.push_back(node.info);
+
+        return;
     }
 
-    return (float)d;
+    // Elements in the left son are no greater than the median along the splitting axis, those in the right son no smaller
+    const unsigned int current_dim = depth % DIM;
+    const float median = node.info.dims[current_dim];
+
+    if (point.dims[current_dim] - radius <= median)
+        this->recRadiusSearch(depth + 1, node.left, point, radius, recHits);
+
+    if (point.dims[current_dim] + radius >= median)
+        this->recRadiusSearch(depth + 1, node.right, point, radius, recHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::clearTree()
+inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const int current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
-    delete[] nodePool_;
-    nodePool_ = nullptr;
-    root_ = nullptr;
-    nodePoolSize_ = -1;
-    nodePoolPos_ = -1;
+    const KDTreeNodeT<DATA, DIM> &node(nodes_[current]);
+
+    if (this->isLeaf(node))
+    {
+        // Leaf case
+        recHits.push_back(node.info);
+    }
+    else
+    {
+        // Node case
+        this->addSubtree(node.left, recHits);
+        this->addSubtree(node.right, recHits);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline bool KDTreeLinkerAlgo<DATA, DIM>::empty()
+inline bool KDTreeLinkerAlgo<DATA, DIM>::isLeaf(const KDTreeNodeT<DATA, DIM> &node) const
 {
-    return (nodePoolPos_ == -1);
+    return ((node.left < 0) && (node.right < 0));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline int KDTreeLinkerAlgo<DATA, DIM>::size()
+inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const
 {
-    return (nodePoolPos_ + 1);
+    double d = 0.;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const double diff = a.dims[i] - b.dims[i];
+        d += diff * diff;
+    }
+
+    return (float)d;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::clear()
+inline bool KDTreeLinkerAlgo<DATA, DIM>::empty() const
 {
-    if (root_)
-        this->clearTree();
+    return nodes_.empty();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::getNextNode()
+inline int KDTreeLinkerAlgo<DATA, DIM>::size() const
 {
-    ++nodePoolPos_;
+    return static_cast<int>(nodes_.size());
+}
 
-    // The tree size is exactly 2 * nbrElts - 1 and this is the total allocated memory.
-    // If we have used more than that....there is a big problem.
-    //assert(nodePoolPos_ < nodePoolSize_);
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    return &(nodePool_[nodePoolPos_]);
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::clear()
+{
+    NodeVector().swap(nodes_);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(int low, int high, int depth, const KDTreeBoxT<DIM> &region)
+inline int KDTreeLinkerAlgo<DATA, DIM>::recBuild(
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int depth, const KDTreeBoxT<DIM> &region)
 {
     const int portionSize = high - low;
 
     // By construction, portionSize > 0 can't happen.
     //assert(portionSize > 0);
 
+    // Nodes are appended in depth-first order, so each node is followed by its left son
+    const int current = static_cast<int>(nodes_.size());
+    nodes_.push_back(KDTreeNodeT<DATA, DIM>());
+
     if (portionSize == 1)
     {
         // Leaf case
-        KDTreeNodeT<DATA, DIM> *leaf = this->getNextNode();
-        leaf->setAttributs(region, (*initialEltList)[low]);
-        return leaf;
+        nodes_[current].setAttributs(region, eltList[low]);
+        return current;
     }
     else
     {
         // The even depth is associated to dim1 dimension, the odd one to dim2 dimension
-        int medianId = this->medianSearch(low, high, depth);
+        int medianId = this->medianSearch(eltList, low, high, depth);
 
         // We create the node
-        KDTreeNodeT<DATA, DIM> *node = this->getNextNode();
-        node->setAttributs(region);
-        node->info = (*initialEltList)[medianId];
+        nodes_[current].setAttributs(region, eltList[medianId]);
 
         // Here we split into 2 halfplanes the current plane
         KDTreeBoxT<DIM> leftRegion = region;
         KDTreeBoxT<DIM> rightRegion = region;
 
         const unsigned thedim = depth % DIM;
-        auto medianVal = (*initialEltList)[medianId].dims[thedim];
+        auto medianVal = eltList[medianId].dims[thedim];
         leftRegion.dimmax[thedim] = medianVal;
         rightRegion.dimmin[thedim] = medianVal;
 
@@ -543,9 +691,11 @@ inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(int low, in
         ++medianId;
 
         // We recursively build the son nodes
-        node->left = this->recBuild(low, medianId, depth, leftRegion);
-        node->right = this->recBuild(medianId, high, depth, rightRegion);
-        return node;
+        const int left = this->recBuild(eltList, low, medianId, depth, leftRegion);
+        const int right = this->recBuild(eltList, medianId, high, depth, rightRegion);
+        nodes_[current].left = left;
+        nodes_[current].right = right;
+        return current;
     }
 }
 
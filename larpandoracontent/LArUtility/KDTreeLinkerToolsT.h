@@ -55,6 +55,7 @@ public:
 
 typedef KDTreeBoxT<2> KDTreeBox;
 typedef KDTreeBoxT<3> KDTreeCube;
+typedef std::vector<KDTreeBox> KDTreeBoxVector;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -114,8 +115,8 @@ public:
     void setAttributs(const KDTreeBoxT<DIM> &regionBox);
 
     KDTreeNodeInfoT<DATA, DIM> info; ///< Data
-    KDTreeNodeT<DATA, DIM> *left;    ///< Left son
-    KDTreeNodeT<DATA, DIM> *right;   ///< Right son
+    int left;                        ///< Index of left son in the tree node array, -1 for a leaf
+    int right;                       ///< Index of right son in the tree node array, -1 for a leaf
     KDTreeBoxT<DIM> region;          ///< Region bounding box.
 };
 
@@ -262,7 +263,7 @@ inline KDTreeNodeInfoT<DATA, DIM>::KDTreeNodeInfoT(const DATA &d, Ts... dimargs)
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeNodeT<DATA, DIM>::KDTreeNodeT() : left(nullptr), right(nullptr)
+inline KDTreeNodeT<DATA, DIM>::KDTreeNodeT() : left(-1), right(-1)
 {
 }
 
@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArVertex/CandidateVertexCreationAlgorithm.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 using namespace pandora;
@@ -258,18 +260,26 @@ void CandidateVertexCreationAlgorithm::FindCrossingPoints(const ClusterVector &c
 
     for (const Cluster *const pCluster : clusterVector)
     {
-        ClusterToSpacepointsMap::iterator mapIter(clusterToSpacepointsMap.emplace(pCluster, CartesianPointVector()).first);
-        this->GetSpacepoints(pCluster, mapIter->second);
+        ClusterToSpacepointsMap::iterator mapIter(clusterToSpacepointsMap.emplace(pCluster, ClusterSpacepoints()).first);
+        this->GetSpacepoints(pCluster, mapIter->second.m_spacepoints);
+        this->IndexSpacepoints(mapIter->second);
     }
 
     for (const Cluster *const pCluster1 : clusterVector)
     {
+        const ClusterSpacepoints &clusterSpacepoints1(clusterToSpacepointsMap.at(pCluster1));
+
         for (const Cluster *const pCluster2 : clusterVector)
         {
             if (pCluster1 == pCluster2)
                 continue;
 
-            this->FindCrossingPoints(clusterToSpacepointsMap.at(pCluster1), clusterToSpacepointsMap.at(pCluster2), crossingPoints);
+            const ClusterSpacepoints &clusterSpacepoints2(clusterToSpacepointsMap.at(pCluster2));
+
+            if (!this->CouldCross(clusterSpacepoints1, clusterSpacepoints2))
+                continue;
+
+            this->FindCrossingPoints(clusterSpacepoints1.m_spacepoints, clusterSpacepoints2, crossingPoints);
         }
     }
 }
@@ -301,27 +311,93 @@ void CandidateVertexCreationAlgorithm::GetSpacepoints(const Cluster *const pClus
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void CandidateVertexCreationAlgorithm::IndexSpacepoints(ClusterSpacepoints &clusterSpacepoints) const
+{
+    const CartesianPointVector &spacepoints(clusterSpacepoints.m_spacepoints);
+    ClusterSpacepoints::DriftIndex &driftIndex(clusterSpacepoints.m_driftIndex);
+
+    clusterSpacepoints.m_minX = std::numeric_limits<float>::max();
+    clusterSpacepoints.m_maxX = -std::numeric_limits<float>::max();
+    clusterSpacepoints.m_minZ = std::numeric_limits<float>::max();
+    clusterSpacepoints.m_maxZ = -std::numeric_limits<float>::max();
+
+    driftIndex.clear();
+    driftIndex.reserve(spacepoints.size());
+
+    for (unsigned int index = 0; index < spacepoints.size(); ++index)
+    {
+        const CartesianVector &position(spacepoints.at(index));
+        driftIndex.emplace_back(position.GetX(), index);
+
+        clusterSpacepoints.m_minX = std::min(clusterSpacepoints.m_minX, position.GetX());
+        clusterSpacepoints.m_maxX = std::max(clusterSpacepoints.m_maxX, position.GetX());
+        clusterSpacepoints.m_minZ = std::min(clusterSpacepoints.m_minZ, position.GetZ());
+        clusterSpacepoints.m_maxZ = std::max(clusterSpacepoints.m_maxZ, position.GetZ());
+    }
+
+    std::sort(driftIndex.begin(), driftIndex.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CandidateVertexCreationAlgorithm::CouldCross(const ClusterSpacepoints &spacepoints1, const ClusterSpacepoints &spacepoints2) const
+{
+    const float deltaX(std::max(0.f, std::max(spacepoints2.m_minX - spacepoints1.m_maxX, spacepoints1.m_minX - spacepoints2.m_maxX)));
+    const float deltaZ(std::max(0.f, std::max(spacepoints2.m_minZ - spacepoints1.m_maxZ, spacepoints1.m_minZ - spacepoints2.m_maxZ)));
+
+    return ((deltaX * deltaX < m_maxCrossingSeparationSquared) && (deltaZ * deltaZ < m_maxCrossingSeparationSquared));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CandidateVertexCreationAlgorithm::FindCrossingPoints(
-    const CartesianPointVector &spacepoints1, const CartesianPointVector &spacepoints2, CartesianPointVector &crossingPoints) const
+    const CartesianPointVector &spacepoints1, const ClusterSpacepoints &clusterSpacepoints2, CartesianPointVector &crossingPoints) const
 {
+    const CartesianPointVector &spacepoints2(clusterSpacepoints2.m_spacepoints);
+    const ClusterSpacepoints::DriftIndex &driftIndex(clusterSpacepoints2.m_driftIndex);
+
     bool bestCrossingFound(false);
     float bestSeparationSquared(m_maxCrossingSeparationSquared);
     CartesianVector bestPosition1(0.f, 0.f, 0.f), bestPosition2(0.f, 0.f, 0.f);
 
     for (const CartesianVector &position1 : spacepoints1)
     {
-        for (const CartesianVector &position2 : spacepoints2)
+        const float x1(position1.GetX());
+
+        // Only spacepoints with drift separation (squared) below the best separation (squared) can provide a closer crossing
+        ClusterSpacepoints::DriftIndex::const_iterator iter(std::partition_point(driftIndex.begin(), driftIndex.end(),
+            [x1, bestSeparationSquared](const ClusterSpacepoints::DriftIndexEntry &entry) {
+                return ((entry.first < x1) && ((x1 - entry.first) * (x1 - entry.first) >= bestSeparationSquared));
+            }));
+
+        // ATTN Choose the closest spacepoint, then the earliest in the spacepoint vector, as for an exhaustive search in vector order
+        bool crossingFound(false);
+        float crossingSeparationSquared(bestSeparationSquared);
+        unsigned int crossingIndex(0);
+
+        for (ClusterSpacepoints::DriftIndex::const_iterator iterEnd = driftIndex.end(); iter != iterEnd; ++iter)
         {
-            const float separationSquared((position1 - position2).GetMagnitudeSquared());
+            if ((iter->first > x1) && ((iter->first - x1) * (iter->first - x1) >= bestSeparationSquared))
+                break;
+
+            const float separationSquared((position1 - spacepoints2.at(iter->second)).GetMagnitudeSquared());
 
-            if (separationSquared < bestSeparationSquared)
+            if ((separationSquared < crossingSeparationSquared) ||
+                (crossingFound && (separationSquared == crossingSeparationSquared) && (iter->second < crossingIndex)))
             {
-                bestCrossingFound = true;
-                bestSeparationSquared = separationSquared;
-                bestPosition1 = position1;
-                bestPosition2 = position2;
+                crossingFound = true;
+                crossingSeparationSquared = separationSquared;
+                crossingIndex = iter->second;
             }
         }
+
+        if (crossingFound)
+        {
+            bestCrossingFound = true;
+            bestSeparationSquared = crossingSeparationSquared;
+            bestPosition1 = position1;
+            bestPosition2 = spacepoints2.at(crossingIndex);
+        }
     }
 
     if (bestCrossingFound)
@@ -29,6 +29,23 @@ public:
     CandidateVertexCreationAlgorithm();
 
 private:
+    /**
+     *  @brief  ClusterSpacepoints class, holding the spacepoints for a cluster, indexed by drift coordinate
+     */
+    class ClusterSpacepoints
+    {
+    public:
+        typedef std::pair<float, unsigned int> DriftIndexEntry; ///< The drift coordinate and position in the spacepoint vector
+        typedef std::vector<DriftIndexEntry> DriftIndex;
+
+        pandora::CartesianPointVector m_spacepoints; ///< The spacepoints
+        DriftIndex m_driftIndex;                     ///< The spacepoint drift coordinates and positions, in drift coordinate order
+        float m_minX;                                ///< The minimum spacepoint x coordinate
+        float m_maxX;                                ///< The maximum spacepoint x coordinate
+        float m_minZ;                                ///< The minimum spacepoint z coordinate
+        float m_maxZ;                                ///< The maximum spacepoint z coordinate
+    };
+
     pandora::StatusCode Run();
 
     /**
@@ -83,14 +100,31 @@ private:
      */
     void GetSpacepoints(const pandora::Cluster *const pCluster, pandora::CartesianPointVector &spacePoints) const;
 
+    /**
+     *  @brief  Index a list of spacepoints by drift coordinate and record their extent
+     *
+     *  @param  clusterSpacepoints the cluster spacepoints, to be indexed
+     */
+    void IndexSpacepoints(ClusterSpacepoints &clusterSpacepoints) const;
+
+    /**
+     *  @brief  Whether the spacepoints for two clusters could lie within the max crossing separation
+     *
+     *  @param  spacepoints1 the spacepoints for cluster 1
+     *  @param  spacepoints2 the spacepoints for cluster 2
+     *
+     *  @return boolean
+     */
+    bool CouldCross(const ClusterSpacepoints &spacepoints1, const ClusterSpacepoints &spacepoints2) const;
+
     /**
      *  @brief  Identify where (extrapolated) clusters plausibly cross in 2D
      *
      *  @param  spacepoints1 space points for cluster 1
-     *  @param  spacepoints2 space points for cluster 2
+     *  @param  clusterSpacepoints2 space points for cluster 2, indexed by drift coordinate
      *  @param  crossingPoints to receive the list of plausible 2D crossing points
      */
-    void FindCrossingPoints(const pandora::CartesianPointVector &spacepoints1, const pandora::CartesianPointVector &spacepoints2,
+    void FindCrossingPoints(const pandora::CartesianPointVector &spacepoints1, const ClusterSpacepoints &clusterSpacepoints2,
         pandora::CartesianPointVector &crossingPoints) const;
 
     /**
@@ -131,7 +165,7 @@ private:
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    typedef std::unordered_map<const pandora::Cluster *, pandora::CartesianPointVector> ClusterToSpacepointsMap;
+    typedef std::unordered_map<const pandora::Cluster *, ClusterSpacepoints> ClusterToSpacepointsMap;
 
     pandora::StringVector m_inputClusterListNames; ///< The list of cluster list names
     std::string m_inputVertexListName;             ///< The list name for existing candidate vertices
@@ -148,15 +148,9 @@ float RPhiFeatureTool::GetMidwayScore(const KernelEstimate &kernelEstimateU, con
 float RPhiFeatureTool::GetFullScore(const KernelEstimate &kernelEstimateU, const KernelEstimate &kernelEstimateV, const KernelEstimate &kernelEstimateW) const
 {
     float figureOfMerit(0.f);
-
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateU.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateU.Sample(contribution.first);
-
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateV.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateV.Sample(contribution.first);
-
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateW.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateW.Sample(contribution.first);
+    kernelEstimateU.SampleContributions(figureOfMerit);
+    kernelEstimateV.SampleContributions(figureOfMerit);
+    kernelEstimateW.SampleContributions(figureOfMerit);
 
     return figureOfMerit;
 }
@@ -164,7 +158,7 @@ float RPhiFeatureTool::GetFullScore(const KernelEstimate &kernelEstimateU, const
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitType hitType,
-    VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const
+    const VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const
 {
     const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
     KDTreeBox searchRegionHits = build_2d_kd_search_region(vertexPosition2D, m_maxHitVertexDisplacement1D, m_maxHitVertexDisplacement1D);
@@ -191,6 +185,8 @@ void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitT
 
         kernelEstimate.AddContribution(phi, weight);
     }
+
+    kernelEstimate.SortContributions();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -214,28 +210,67 @@ float RPhiFeatureTool::atan2Fast(const float y, const float x) const
 
 float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 {
-    const ContributionList &contributionList(this->GetContributionList());
-    ContributionList::const_iterator lowerIter(contributionList.lower_bound(x - 3.f * m_sigma));
-    ContributionList::const_iterator upperIter(contributionList.upper_bound(x + 3.f * m_sigma));
+    const float lowerX(x - 3.f * m_sigma), upperX(x + 3.f * m_sigma);
+    ContributionList::const_iterator lowerIter(std::lower_bound(m_contributionList.begin(), m_contributionList.end(), lowerX,
+        [](const Contribution &contribution, const float value) { return contribution.first < value; }));
+    ContributionList::const_iterator upperIter(std::upper_bound(lowerIter, m_contributionList.end(), upperX,
+        [](const float value, const Contribution &contribution) { return value < contribution.first; }));
 
-    float sample(0.f);
-    const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
+    return this->Sample(x, lowerIter, upperIter);
+}
 
-    for (ContributionList::const_iterator iter = lowerIter; iter != upperIter; ++iter)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::KernelEstimate::SampleContributions(float &sum) const
+{
+    // ATTN Contributions are sampled in order of increasing x coord, so the sampling window only ever moves forwards
+    ContributionList::const_iterator lowerIter(m_contributionList.begin()), upperIter(m_contributionList.begin());
+
+    for (const Contribution &contribution : m_contributionList)
     {
-        const float deltaSigma((x - iter->first) / m_sigma);
-        const float gaussian(gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
-        sample += iter->second * gaussian;
-    }
+        const float x(contribution.first);
 
-    return sample;
+        while ((lowerIter != m_contributionList.end()) && (lowerIter->first < x - 3.f * m_sigma))
+            ++lowerIter;
+
+        while ((upperIter != m_contributionList.end()) && !(x + 3.f * m_sigma < upperIter->first))
+            ++upperIter;
+
+        sum += contribution.second * this->Sample(x, lowerIter, upperIter);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void RPhiFeatureTool::KernelEstimate::AddContribution(const float x, const float weight)
 {
-    m_contributionList.insert(ContributionList::value_type(x, weight));
+    m_contributionList.emplace_back(x, weight);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::KernelEstimate::SortContributions()
+{
+    // ATTN Stable sort on x coord alone, so contributions at the same x coord retain the order in which they were added
+    std::stable_sort(m_contributionList.begin(), m_contributionList.end(),
+        [](const Contribution &lhs, const Contribution &rhs) { return lhs.first < rhs.first; });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float RPhiFeatureTool::KernelEstimate::Sample(
+    const float x, const ContributionList::const_iterator lowerIter, const ContributionList::const_iterator upperIter) const
+{
+    float sample(0.f);
+
+    for (ContributionList::const_iterator iter = lowerIter; iter != upperIter; ++iter)
+    {
+        const float deltaSigma((x - iter->first) / m_sigma);
+        const float gaussian(m_gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
+        sample += iter->second * gaussian;
+    }
+
+    return sample;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -65,7 +65,15 @@ private:
          */
         float Sample(const float x) const;
 
-        typedef std::multimap<float, float> ContributionList; ///< Map from x coord to weight, ATTN avoid map.find, etc. with float key
+        /**
+         *  @brief  Sample the parameterised distribution at the position of each contribution, adding the weighted samples to a sum
+         *
+         *  @param  sum to receive the weighted samples, in order of increasing contribution x coord
+         */
+        void SampleContributions(float &sum) const;
+
+        typedef std::pair<float, float> Contribution;      ///< Pair of x coord and weight
+        typedef std::vector<Contribution> ContributionList; ///< Contributions in order of increasing x coord, once sorted
 
         /**
          *  @brief  Get the contribution list
@@ -89,9 +97,27 @@ private:
          */
         void AddContribution(const float x, const float weight);
 
+        /**
+         *  @brief  Sort the contributions by x coord, which must be done after adding contributions and before using the distribution
+         */
+        void SortContributions();
+
     private:
+        /**
+         *  @brief  Sum the gaussian contributions within a window of three sigma about a specified x coordinate
+         *
+         *  @param  x the position at which to sample
+         *  @param  lowerIter iterator to the first contribution within the window
+         *  @param  upperIter iterator past the last contribution within the window
+         *
+         *  @return the sample value
+         */
+        float Sample(
+            const float x, const ContributionList::const_iterator lowerIter, const ContributionList::const_iterator upperIter) const;
+
         ContributionList m_contributionList; ///< The contribution list
         const float m_sigma;                 ///< The assigned width
+        const float m_gaussConstant;         ///< The gaussian normalisation constant
     };
 
     //--------------------------------------------------------------------------------------------------------------------------------------
@@ -140,7 +166,7 @@ private:
      *  @param  kernelEstimate to receive the populated kernel estimate
      */
     void FillKernelEstimate(const pandora::Vertex *const pVertex, const pandora::HitType hitType,
-        VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const;
+        const VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const;
 
     /**
      *  @brief  Whether to accept a candidate vertex, based on its spatial position in relation to other selected candidates
@@ -180,7 +206,9 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) : m_sigma(sigma)
+inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) :
+    m_sigma(sigma),
+    m_gaussConstant(1.f / std::sqrt(2.f * M_PI * sigma * sigma))
 {
     if (m_sigma < std::numeric_limits<float>::epsilon())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
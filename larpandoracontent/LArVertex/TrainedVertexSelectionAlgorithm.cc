@@ -66,13 +66,23 @@ void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterLi
 {
     ClusterEndPointsMap clusterEndPointsMap;
     ClusterList showerLikeClusters;
-    this->GetShowerLikeClusterEndPoints(inputClusterList, showerLikeClusters, clusterEndPointsMap);
+
+    // ATTN Cluster end points are only required by the shower clustering approximation
+    if (m_useShowerClusteringApproximation)
+    {
+        this->GetShowerLikeClusterEndPoints(inputClusterList, showerLikeClusters, clusterEndPointsMap);
+    }
+    else
+    {
+        this->GetShowerLikeClusters(inputClusterList, showerLikeClusters);
+    }
 
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
     ClusterList availableShowerLikeClusters(showerLikeClusters.begin(), showerLikeClusters.end());
 
     HitKDTree2D kdTree;
     HitToClusterMap hitToClusterMap;
+    ClusterToNearbyClustersMap nearbyClustersMap;
 
     if (!m_useShowerClusteringApproximation)
         this->PopulateKdTree(availableShowerLikeClusters, kdTree, hitToClusterMap);
@@ -91,7 +101,8 @@ void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterLi
             {
                 if (!m_useShowerClusteringApproximation)
                 {
-                    addedCluster = this->AddClusterToShower(kdTree, hitToClusterMap, availableShowerLikeClusters, pCluster, showerCluster);
+                    addedCluster = this->AddClusterToShower(
+                        kdTree, hitToClusterMap, nearbyClustersMap, availableShowerLikeClusters, pCluster, showerCluster);
                 }
                 else
                 {
@@ -116,6 +127,20 @@ void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterLi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrainedVertexSelectionAlgorithm::GetShowerLikeClusters(const ClusterList &clusterList, ClusterList &showerLikeClusters) const
+{
+    for (const Cluster *const pCluster : clusterList)
+    {
+        if (pCluster->GetNCaloHits() < m_minShowerClusterHits)
+            continue;
+
+        if (this->IsClusterShowerLike(pCluster))
+            showerLikeClusters.push_back(pCluster);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TrainedVertexSelectionAlgorithm::GetShowerLikeClusterEndPoints(
     const ClusterList &clusterList, ClusterList &showerLikeClusters, ClusterEndPointsMap &clusterEndPointsMap) const
 {
@@ -203,22 +228,10 @@ bool TrainedVertexSelectionAlgorithm::AddClusterToShower(const ClusterEndPointsM
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool TrainedVertexSelectionAlgorithm::AddClusterToShower(HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap,
-    ClusterList &availableShowerLikeClusters, const Cluster *const pCluster, ClusterList &showerCluster) const
+    ClusterToNearbyClustersMap &nearbyClustersMap, ClusterList &availableShowerLikeClusters, const Cluster *const pCluster,
+    ClusterList &showerCluster) const
 {
-    ClusterSet nearbyClusters;
-    CaloHitList daughterHits;
-    pCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
-
-    for (const CaloHit *const pCaloHit : daughterHits)
-    {
-        KDTreeBox searchRegionHits = build_2d_kd_search_region(pCaloHit, m_showerClusteringDistance, m_showerClusteringDistance);
-
-        HitKDNode2DList found;
-        kdTree.search(searchRegionHits, found);
-
-        for (const auto &hit : found)
-            (void)nearbyClusters.insert(hitToClusterMap.at(hit.data));
-    }
+    const ClusterSet &nearbyClusters(this->GetNearbyClusters(kdTree, hitToClusterMap, nearbyClustersMap, pCluster));
 
     for (auto iter = availableShowerLikeClusters.begin(); iter != availableShowerLikeClusters.end(); ++iter)
     {
@@ -237,6 +250,39 @@ bool TrainedVertexSelectionAlgorithm::AddClusterToShower(HitKDTree2D &kdTree, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const ClusterSet &TrainedVertexSelectionAlgorithm::GetNearbyClusters(HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap,
+    ClusterToNearbyClustersMap &nearbyClustersMap, const Cluster *const pCluster) const
+{
+    // ATTN The kd tree is fixed for the lifetime of the shower clustering, so the search for each cluster need only be performed once
+    ClusterToNearbyClustersMap::const_iterator mapIter(nearbyClustersMap.find(pCluster));
+
+    if (nearbyClustersMap.end() != mapIter)
+        return mapIter->second;
+
+    ClusterSet &nearbyClusters(nearbyClustersMap[pCluster]);
+    CaloHitList daughterHits;
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
+
+    KDTreeBoxVector searchRegions;
+    searchRegions.reserve(daughterHits.size());
+
+    for (const CaloHit *const pCaloHit : daughterHits)
+        searchRegions.push_back(build_2d_kd_search_region(pCaloHit, m_showerClusteringDistance, m_showerClusteringDistance));
+
+    std::vector<HitKDNode2DList> foundLists;
+    kdTree.search(searchRegions, foundLists);
+
+    for (const HitKDNode2DList &found : foundLists)
+    {
+        for (const auto &hit : found)
+            (void)nearbyClusters.insert(hitToClusterMap.at(hit.data));
+    }
+
+    return nearbyClusters;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 typename TrainedVertexSelectionAlgorithm::EventFeatureInfo TrainedVertexSelectionAlgorithm::CalculateEventFeatures(
     const ClusterList &clusterListU, const ClusterList &clusterListV, const ClusterList &clusterListW, const VertexVector &vertexVector) const
 {
@@ -154,6 +154,14 @@ protected:
      */
     void CalculateShowerClusterList(const pandora::ClusterList &inputClusterList, ShowerClusterList &showerClusterList) const;
 
+    /**
+     *  @brief  Get the shower-like clusters from a cluster list
+     *
+     *  @param  clusterList the list of clusters
+     *  @param  showerLikeClusters the list of shower-like clusters to populate
+     */
+    void GetShowerLikeClusters(const pandora::ClusterList &clusterList, pandora::ClusterList &showerLikeClusters) const;
+
     /**
      *  @brief  Add the endpoints of any shower-like clusters to the map
      *
@@ -169,6 +177,7 @@ protected:
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
 
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
+    typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterSet> ClusterToNearbyClustersMap;
 
     /**
      * @brief   Populate kd tree with information about hits in a provided list of clusters
@@ -197,14 +206,28 @@ protected:
      *
      *  @param  kdTree the kd tree, used purely for efficiency in events with large hit multiplicity
      *  @param  hitToClusterMap the hit to cluster map, used to interpret kd tree findings
+     *  @param  nearbyClustersMap the cache of nearby clusters, filled on first use for each cluster
      *  @param  availableShowerLikeClusters the list of shower-like clusters still available
      *  @param  pCluster the cluster in the shower cluster from which to consider distances
      *  @param  showerCluster the shower cluster
      *
      *  @return boolean
      */
-    bool AddClusterToShower(HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap, pandora::ClusterList &availableShowerLikeClusters,
-        const pandora::Cluster *const pCluster, pandora::ClusterList &showerCluster) const;
+    bool AddClusterToShower(HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap, ClusterToNearbyClustersMap &nearbyClustersMap,
+        pandora::ClusterList &availableShowerLikeClusters, const pandora::Cluster *const pCluster, pandora::ClusterList &showerCluster) const;
+
+    /**
+     *  @brief  Get the clusters with hits lying within the shower clustering distance of the hits in a given cluster
+     *
+     *  @param  kdTree the kd tree
+     *  @param  hitToClusterMap the hit to cluster map, used to interpret kd tree findings
+     *  @param  nearbyClustersMap the cache of nearby clusters, filled on first use for each cluster
+     *  @param  pCluster the cluster
+     *
+     *  @return the set of nearby clusters
+     */
+    const pandora::ClusterSet &GetNearbyClusters(HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap,
+        ClusterToNearbyClustersMap &nearbyClustersMap, const pandora::Cluster *const pCluster) const;
 
     /**
      *  @brief  Calculate the event parameters
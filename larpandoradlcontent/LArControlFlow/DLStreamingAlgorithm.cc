@@ -0,0 +1,28 @@
+/**
+ *  @file   larpandoradlcontent/LArControlFlow/DLStreamingAlgorithm.cc
+ *
+ *  @brief  Implementation of the deep learning streaming algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoradlcontent/LArControlFlow/DLStreamingAlgorithm.h"
+#include "larpandoradlcontent/LArDLContent.h"
+
+using namespace pandora;
+
+namespace lar_dl_content
+{
+
+StatusCode DLStreamingAlgorithm::RegisterCustomContent(const Pandora *const pPandora) const
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLContent::RegisterAlgorithms(*pPandora));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_dl_content
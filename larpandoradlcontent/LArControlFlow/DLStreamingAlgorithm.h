@@ -0,0 +1,33 @@
+/**
+ *  @file   larpandoradlcontent/LArControlFlow/DLStreamingAlgorithm.h
+ *
+ *  @brief  Header file for the deep learning streaming algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_DL_STREAMING_ALGORITHM_H
+#define LAR_DL_STREAMING_ALGORITHM_H 1
+
+#include "larpandoracontent/LArControlFlow/StreamingAlgorithm.h"
+
+namespace lar_dl_content
+{
+
+/**
+ *  @brief  DLStreamingAlgorithm class, registering the deep learning content with any stream worker instances
+ */
+class DLStreamingAlgorithm : public lar_content::StreamingAlgorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    DLStreamingAlgorithm() = default;
+
+private:
+    pandora::StatusCode RegisterCustomContent(const pandora::Pandora *const pPandora) const;
+};
+
+} // namespace lar_dl_content
+
+#endif // #ifndef LAR_DL_STREAMING_ALGORITHM_H
@@ -13,6 +13,7 @@
 #include "Pandora/Pandora.h"
 
 #include "larpandoradlcontent/LArControlFlow/DLMasterAlgorithm.h"
+#include "larpandoradlcontent/LArControlFlow/DLStreamingAlgorithm.h"
 #include "larpandoradlcontent/LArMonitoring/DlHitValidationAlgorithm.h"
 #include "larpandoradlcontent/LArTrackShowerId/DlClusterCharacterisationAlgorithm.h"
 #include "larpandoradlcontent/LArTrackShowerId/DlHitTrackShowerIdAlgorithm.h"
@@ -25,6 +26,7 @@
 // clang-format off
 #define LAR_DL_ALGORITHM_LIST(d)                                                                                                           \
     d("LArDLMaster", DLMasterAlgorithm)                                                                                                    \
+    d("LArDLStreaming", DLStreamingAlgorithm)                                                                                              \
     d("LArDLClusterCharacterisation", DlClusterCharacterisationAlgorithm)                                                                  \
     d("LArDLHitTrackShowerId", DlHitTrackShowerIdAlgorithm)                                                                                \
     d("LArDLPfoCharacterisation", DlPfoCharacterisationAlgorithm)                                                                          \
@@ -6,13 +6,24 @@
  *  $Log: $
  */
 
+#include "Objects/Cluster.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+
 #include "larpandoradlcontent/LArHelpers/LArDLHelper.h"
 
+#include <limits>
+
 namespace lar_dl_content
 {
 
 using namespace pandora;
 
+std::mutex LArDLHelper::m_modelRegistryMutex;
+LArDLHelper::ModelRegistry LArDLHelper::m_modelRegistry;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::TorchModel &model)
 {
     try
@@ -31,6 +42,27 @@ StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::Torc
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::TorchModelPtr &pModel)
+{
+    // ATTN Lock held whilst loading, so that concurrently configured instances requesting the same model load it only once
+    const std::lock_guard<std::mutex> lock(m_modelRegistryMutex);
+    std::weak_ptr<TorchModel> &pRegisteredModel(m_modelRegistry[filename]);
+    pModel = pRegisteredModel.lock();
+
+    if (pModel)
+        return STATUS_CODE_SUCCESS;
+
+    TorchModel model;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(filename, model));
+
+    pModel = std::make_shared<TorchModel>(std::move(model));
+    pRegisteredModel = pModel;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArDLHelper::InitialiseInput(const at::IntArrayRef dimensions, TorchInput &tensor)
 {
     tensor = torch::zeros(dimensions);
@@ -43,4 +75,35 @@ void LArDLHelper::Forward(TorchModel &model, const TorchInputVector &input, Torc
     output = model.forward(input).toTensor();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::AccumulateTrackLikelihoods(const Cluster *const pCluster, float &likelihoodSum, unsigned long &nLikelihoods)
+{
+    auto addLikelihood = [&likelihoodSum, &nLikelihoods](const CaloHit *const pCaloHit) {
+        const lar_content::LArCaloHit *const pLArCaloHit{dynamic_cast<const lar_content::LArCaloHit *>(pCaloHit)};
+
+        if (!pLArCaloHit)
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        const float pTrack{pLArCaloHit->GetTrackProbability()};
+        const float pShower{pLArCaloHit->GetShowerProbability()};
+
+        if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
+        {
+            likelihoodSum += pTrack / (pTrack + pShower);
+            ++nLikelihoods;
+        }
+    };
+
+    // ATTN Visit hits in the same order as OrderedCaloHitList::FillCaloHitList, then the isolated hits, to preserve the floating point sum
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            addLikelihood(pCaloHit);
+    }
+
+    for (const CaloHit *const pCaloHit : pCluster->GetIsolatedCaloHitList())
+        addLikelihood(pCaloHit);
+}
+
 } // namespace lar_dl_content
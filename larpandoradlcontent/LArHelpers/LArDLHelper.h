@@ -13,6 +13,17 @@
 
 #include "Pandora/StatusCodes.h"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace pandora
+{
+class Cluster;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 namespace lar_dl_content
 {
 
@@ -23,6 +34,7 @@ class LArDLHelper
 {
 public:
     typedef torch::jit::script::Module TorchModel;
+    typedef std::shared_ptr<TorchModel> TorchModelPtr;
     typedef torch::Tensor TorchInput;
     typedef std::vector<torch::jit::IValue> TorchInputVector;
     typedef at::Tensor TorchOutput;
@@ -37,6 +49,17 @@ public:
      */
     static pandora::StatusCode LoadModel(const std::string &filename, TorchModel &model);
 
+    /**
+     *  @brief  Get a shared deep learning model, loading it only if no algorithm instance, in any pandora instance, currently holds the
+     *          model loaded from this file. The model is released once the last algorithm instance holding it is destroyed.
+     *
+     *  @param  filename the filename of the model to load
+     *  @param  pModel to receive the shared model
+     *
+     *  @return STATUS_CODE_SUCCESS upon successful loading of the model. STATUS_CODE_FAILURE otherwise.
+     */
+    static pandora::StatusCode LoadModel(const std::string &filename, TorchModelPtr &pModel);
+
     /**
      *  @brief  Create a torch input tensor
      *
@@ -53,6 +76,22 @@ public:
      *  @param  output the tensor to store the output in
      */
     static void Forward(TorchModel &model, const TorchInputVector &input, TorchOutput &output);
+
+    /**
+     *  @brief  Add the track likelihoods, pTrack / (pTrack + pShower), of the ordered and isolated hits in a cluster to a running sum, in a
+     *          single pass over the cluster hits. Hits without track or shower probabilities do not contribute.
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  likelihoodSum the running sum of hit track likelihoods
+     *  @param  nLikelihoods the running number of hits contributing to the sum
+     */
+    static void AccumulateTrackLikelihoods(const pandora::Cluster *const pCluster, float &likelihoodSum, unsigned long &nLikelihoods);
+
+private:
+    typedef std::unordered_map<std::string, std::weak_ptr<TorchModel>> ModelRegistry;
+
+    static std::mutex m_modelRegistryMutex; ///< The mutex protecting the shared model registry
+    static ModelRegistry m_modelRegistry;   ///< The map from model filename to shared model, for all models currently in use
 };
 
 } // namespace lar_dl_content
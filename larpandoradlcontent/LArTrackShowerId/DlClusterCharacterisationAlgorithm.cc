@@ -8,12 +8,9 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoradlcontent/LArHelpers/LArDLHelper.h"
 #include "larpandoradlcontent/LArTrackShowerId/DlClusterCharacterisationAlgorithm.h"
 
-#include "larpandoracontent/LArObjects/LArCaloHit.h"
-
-#include <numeric>
-
 using namespace pandora;
 using namespace lar_content;
 
@@ -34,27 +31,15 @@ DlClusterCharacterisationAlgorithm::~DlClusterCharacterisationAlgorithm()
 
 bool DlClusterCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster) const
 {
-    const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-    CaloHitList caloHits;
-    orderedCaloHitList.FillCaloHitList(caloHits);
-    const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-    caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
-    FloatVector trackLikelihoods;
     try
     {
-        for (const CaloHit *pCaloHit : caloHits)
-        {
-            const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-            const float pTrack{pLArCaloHit->GetTrackProbability()};
-            const float pShower{pLArCaloHit->GetShowerProbability()};
-            if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-        }
+        float likelihoodSum{0.f};
+        unsigned long N{0};
+        LArDLHelper::AccumulateTrackLikelihoods(pCluster, likelihoodSum, N);
 
-        const unsigned long N{trackLikelihoods.size()};
         if (N > 0)
         {
-            float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
+            float mean{likelihoodSum / N};
             if (mean >= 0.5f)
                 return true;
             else
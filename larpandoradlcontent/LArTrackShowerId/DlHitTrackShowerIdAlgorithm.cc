@@ -155,7 +155,10 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
         if (!(view == TPC_VIEW_U || view == TPC_VIEW_V || view == TPC_VIEW_W))
             return STATUS_CODE_NOT_ALLOWED;
 
-        LArDLHelper::TorchModel &model{view == TPC_VIEW_U ? m_modelU : (view == TPC_VIEW_V ? m_modelV : m_modelW)};
+        const LArDLHelper::TorchModelPtr &pModel{view == TPC_VIEW_U ? m_pModelU : (view == TPC_VIEW_V ? m_pModelV : m_pModelW)};
+
+        if (!pModel)
+            return STATUS_CODE_NOT_INITIALIZED;
 
         // Get bounds of hit region
         float xMin{};
@@ -248,7 +251,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
             LArDLHelper::TorchInputVector inputs;
             inputs.push_back(input);
             LArDLHelper::TorchOutput output;
-            LArDLHelper::Forward(model, inputs, output);
+            LArDLHelper::Forward(*pModel, inputs, output);
             auto outputAccessor = output.accessor<float, 4>();
 
             for (const CaloHit *pCaloHit : *pCaloHitList)
@@ -378,7 +381,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         if (!m_modelFileNameU.empty())
         {
             m_modelFileNameU = LArFileHelper::FindFileInPath(m_modelFileNameU, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameU, m_modelU));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameU, m_pModelU));
             modelLoaded = true;
         }
         PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -386,7 +389,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         if (!m_modelFileNameV.empty())
         {
             m_modelFileNameV = LArFileHelper::FindFileInPath(m_modelFileNameV, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameV, m_modelV));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameV, m_pModelV));
             modelLoaded = true;
         }
         PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -394,7 +397,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         if (!m_modelFileNameW.empty())
         {
             m_modelFileNameW = LArFileHelper::FindFileInPath(m_modelFileNameW, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameW, m_modelW));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameW, m_pModelW));
             modelLoaded = true;
         }
         if (!modelLoaded)
@@ -71,9 +71,9 @@ private:
     std::string m_modelFileNameU;             ///< Model file name for U view
     std::string m_modelFileNameV;             ///< Model file name for V view
     std::string m_modelFileNameW;             ///< Model file name for W view
-    LArDLHelper::TorchModel m_modelU;         ///< Model for the U view
-    LArDLHelper::TorchModel m_modelV;         ///< Model for the V view
-    LArDLHelper::TorchModel m_modelW;         ///< Model for the W view
+    LArDLHelper::TorchModelPtr m_pModelU;     ///< Model for the U view
+    LArDLHelper::TorchModelPtr m_pModelV;     ///< Model for the V view
+    LArDLHelper::TorchModelPtr m_pModelW;     ///< Model for the W view
     int m_imageHeight;                        ///< Height of images in pixels
     int m_imageWidth;                         ///< Width of images in pixels
     float m_tileSize;                         ///< Size of tile in cm
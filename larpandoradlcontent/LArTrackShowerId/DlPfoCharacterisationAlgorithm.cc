@@ -9,12 +9,10 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
-#include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include "larpandoradlcontent/LArHelpers/LArDLHelper.h"
 #include "larpandoradlcontent/LArTrackShowerId/DlPfoCharacterisationAlgorithm.h"
 
-#include <numeric>
-
 using namespace pandora;
 using namespace lar_content;
 
@@ -29,27 +27,15 @@ DlPfoCharacterisationAlgorithm::DlPfoCharacterisationAlgorithm()
 
 bool DlPfoCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster) const
 {
-    const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-    CaloHitList caloHits;
-    orderedCaloHitList.FillCaloHitList(caloHits);
-    const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-    caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
-    FloatVector trackLikelihoods;
     try
     {
-        for (const CaloHit *pCaloHit : caloHits)
-        {
-            const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-            const float pTrack{pLArCaloHit->GetTrackProbability()};
-            const float pShower{pLArCaloHit->GetShowerProbability()};
-            if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-        }
+        float likelihoodSum{0.f};
+        unsigned long N{0};
+        LArDLHelper::AccumulateTrackLikelihoods(pCluster, likelihoodSum, N);
 
-        const unsigned long N{trackLikelihoods.size()};
         if (N > 0)
         {
-            float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
+            float mean{likelihoodSum / N};
             if (mean >= 0.5f)
                 return true;
             else
@@ -69,34 +55,22 @@ bool DlPfoCharacterisationAlgorithm::IsClearTrack(const pandora::ParticleFlowObj
 {
     ClusterList allClusters;
     LArPfoHelper::GetTwoDClusterList(pPfo, allClusters);
-    FloatVector trackLikelihoods;
+    float likelihoodSum{0.f};
+    unsigned long N{0};
     for (const Cluster *pCluster : allClusters)
     {
-        const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-        CaloHitList caloHits;
-        orderedCaloHitList.FillCaloHitList(caloHits);
-        const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-        caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
         try
         {
-            for (const CaloHit *pCaloHit : caloHits)
-            {
-                const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-                const float pTrack{pLArCaloHit->GetTrackProbability()};
-                const float pShower{pLArCaloHit->GetShowerProbability()};
-                if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                    trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-            }
+            LArDLHelper::AccumulateTrackLikelihoods(pCluster, likelihoodSum, N);
         }
         catch (const StatusCodeException &)
         {
         }
     }
 
-    const unsigned long N{trackLikelihoods.size()};
     if (N > 0)
     {
-        float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
+        float mean{likelihoodSum / N};
         if (mean >= 0.5f)
             return true;
         else
@@ -178,11 +178,11 @@ StatusCode DlVertexingAlgorithm::Infer()
         inputs.push_back(input);
         LArDLHelper::TorchOutput output;
         if (isU)
-            LArDLHelper::Forward(m_modelU, inputs, output);
+            LArDLHelper::Forward(*m_pModelU, inputs, output);
         else if (isV)
-            LArDLHelper::Forward(m_modelV, inputs, output);
+            LArDLHelper::Forward(*m_pModelV, inputs, output);
         else
-            LArDLHelper::Forward(m_modelW, inputs, output);
+            LArDLHelper::Forward(*m_pModelW, inputs, output);
 
         int colOffset{0}, rowOffset{0}, canvasWidth{m_width}, canvasHeight{m_height};
         this->GetCanvasParameters(output, pixelVector, colOffset, rowOffset, canvasWidth, canvasHeight);
@@ -815,13 +815,13 @@ StatusCode DlVertexingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         std::string modelName;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameU", modelName));
         modelName = LArFileHelper::FindFileInPath(modelName, "FW_SEARCH_PATH");
-        LArDLHelper::LoadModel(modelName, m_modelU);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(modelName, m_pModelU));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameV", modelName));
         modelName = LArFileHelper::FindFileInPath(modelName, "FW_SEARCH_PATH");
-        LArDLHelper::LoadModel(modelName, m_modelV);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(modelName, m_pModelV));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameW", modelName));
         modelName = LArFileHelper::FindFileInPath(modelName, "FW_SEARCH_PATH");
-        LArDLHelper::LoadModel(modelName, m_modelW);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(modelName, m_pModelW));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "MaxHitAdc", m_maxHitAdc));
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "WriteTree", m_writeTree));
         if (m_writeTree)
@@ -222,9 +222,9 @@ private:
     std::string m_inputVertexListName;        ///< Input vertex list name if 2nd pass
     std::string m_outputVertexListName;       ///< Output vertex list name
     pandora::StringVector m_caloHitListNames; ///< Names of input calo hit lists
-    LArDLHelper::TorchModel m_modelU;         ///< The model for the U view
-    LArDLHelper::TorchModel m_modelV;         ///< The model for the V view
-    LArDLHelper::TorchModel m_modelW;         ///< The model for the W view
+    LArDLHelper::TorchModelPtr m_pModelU;     ///< The model for the U view
+    LArDLHelper::TorchModelPtr m_pModelV;     ///< The model for the V view
+    LArDLHelper::TorchModelPtr m_pModelW;     ///< The model for the W view
     int m_event;                              ///< The current event number
     int m_pass;                               ///< The pass of the train/infer step
     int m_nClasses;                           ///< The number of distance classes
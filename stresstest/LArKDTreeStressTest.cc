@@ -0,0 +1,341 @@
+/**
+ *  @file   stresstest/LArKDTreeStressTest.cc
+ *
+ *  @brief  Implementation of the lar kd tree stress test application, querying a single kd tree from many threads at once and checking
+ *          the results of each query type against a brute-force search.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace lar_content;
+
+namespace
+{
+
+typedef KDTreeLinkerAlgo<unsigned int, 2> PointKDTree2D;
+typedef KDTreeNodeInfoT<unsigned int, 2> PointKDNode2D;
+typedef std::vector<PointKDNode2D> PointKDNode2DList;
+typedef std::vector<unsigned int> UIntVector;
+
+/**
+ *  @brief  Parameters class
+ */
+class Parameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Parameters();
+
+    unsigned int m_nThreads; ///< The number of threads, each querying the same kd tree
+    unsigned int m_nPoints;  ///< The number of points in the kd tree
+    unsigned int m_nQueries; ///< The number of queries of each type per thread
+    unsigned int m_seed;     ///< The random number seed
+};
+
+/**
+ *  @brief  Parse the command line arguments, setting the application parameters
+ *
+ *  @param  argc argument count
+ *  @param  argv argument vector
+ *  @param  parameters to receive the application parameters
+ *
+ *  @return whether the stress test should proceed
+ */
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters);
+
+/**
+ *  @brief  Print the list of configurable options
+ *
+ *  @return false, to force abort
+ */
+bool PrintOptions();
+
+/**
+ *  @brief  Query the kd tree with random box, nearest neighbour, k nearest neighbour, radius and batched searches, comparing each
+ *          result with that of a brute-force search
+ *
+ *  @param  parameters the application parameters
+ *  @param  threadIndex the index of the thread, used to seed its queries
+ *  @param  kdTree the kd tree, shared by all threads
+ *  @param  pointList the points in the kd tree, indexed by their data
+ *  @param  nErrors to count the inconsistent results
+ */
+void RunThread(const Parameters &parameters, const unsigned int threadIndex, const PointKDTree2D &kdTree,
+    const PointKDNode2DList &pointList, std::atomic<unsigned int> &nErrors);
+
+/**
+ *  @brief  Get the squared distance between two points, evaluated as in the kd tree
+ *
+ *  @param  a the first point
+ *  @param  b the second point
+ *
+ *  @return the squared distance
+ */
+float GetDistanceSquared(const PointKDNode2D &a, const PointKDNode2D &b);
+
+/**
+ *  @brief  Get the sorted data of a list of points
+ *
+ *  @param  pointList the list of points
+ *
+ *  @return the sorted data
+ */
+UIntVector GetSortedData(const PointKDNode2DList &pointList);
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Parameters parameters;
+
+    if (!ParseCommandLine(argc, argv, parameters))
+        return 1;
+
+    std::mt19937 randomEngine(parameters.m_seed);
+    std::uniform_real_distribution<float> positionDistribution(0.f, 100.f);
+    PointKDNode2DList pointList;
+
+    for (unsigned int iPoint = 0; iPoint < parameters.m_nPoints; ++iPoint)
+    {
+        // ATTN Some points are repeated, to exercise the handling of equal coordinates
+        if ((iPoint > 0) && (0 == iPoint % 10))
+            pointList.emplace_back(iPoint, pointList.back().dims[0], pointList.back().dims[1]);
+        else
+            pointList.emplace_back(iPoint, positionDistribution(randomEngine), positionDistribution(randomEngine));
+    }
+
+    PointKDNode2DList kdNodeList(pointList);
+    PointKDTree2D kdTree;
+    kdTree.build(kdNodeList, KDTreeBox(0.f, 100.f, 0.f, 100.f));
+
+    std::atomic<unsigned int> nErrors(0);
+    std::vector<std::thread> threadVector;
+
+    for (unsigned int iThread = 0; iThread < parameters.m_nThreads; ++iThread)
+        threadVector.emplace_back(RunThread, std::cref(parameters), iThread, std::cref(kdTree), std::cref(pointList), std::ref(nErrors));
+
+    for (std::thread &thread : threadVector)
+        thread.join();
+
+    std::cout << "LArKDTreeStressTest: " << parameters.m_nThreads << " threads, " << parameters.m_nPoints << " points, "
+              << parameters.m_nQueries << " queries, " << nErrors << " errors" << std::endl;
+
+    return ((0 == nErrors) ? 0 : 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+Parameters::Parameters() :
+    m_nThreads(8),
+    m_nPoints(5000),
+    m_nQueries(200),
+    m_seed(1)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters)
+{
+    int cOpt(0);
+
+    try
+    {
+        while ((cOpt = getopt(argc, argv, "t:n:q:s:h")) != -1)
+        {
+            switch (cOpt)
+            {
+                case 't':
+                    parameters.m_nThreads = std::stoul(optarg);
+                    break;
+                case 'n':
+                    parameters.m_nPoints = std::stoul(optarg);
+                    break;
+                case 'q':
+                    parameters.m_nQueries = std::stoul(optarg);
+                    break;
+                case 's':
+                    parameters.m_seed = std::stoul(optarg);
+                    break;
+                case 'h':
+                default:
+                    return PrintOptions();
+            }
+        }
+    }
+    catch (const std::logic_error &)
+    {
+        std::cout << "LArKDTreeStressTest: invalid numerical argument" << std::endl;
+        return PrintOptions();
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PrintOptions()
+{
+    const Parameters parameters;
+
+    std::cout << std::endl
+              << "./LArKDTreeStressTest " << std::endl
+              << "    -t NThreads             (optional) [default " << parameters.m_nThreads << "]" << std::endl
+              << "    -n NPoints              (optional) [default " << parameters.m_nPoints << "]" << std::endl
+              << "    -q NQueriesPerThread    (optional) [default " << parameters.m_nQueries << "]" << std::endl
+              << "    -s Seed                 (optional) [default " << parameters.m_seed << "]" << std::endl
+              << std::endl;
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RunThread(const Parameters &parameters, const unsigned int threadIndex, const PointKDTree2D &kdTree,
+    const PointKDNode2DList &pointList, std::atomic<unsigned int> &nErrors)
+{
+    std::mt19937 randomEngine(parameters.m_seed + threadIndex + 1);
+    std::uniform_real_distribution<float> positionDistribution(-10.f, 110.f);
+    std::uniform_real_distribution<float> sizeDistribution(0.f, 10.f);
+    std::uniform_int_distribution<unsigned int> kDistribution(1, 20);
+
+    for (unsigned int iQuery = 0; iQuery < parameters.m_nQueries; ++iQuery)
+    {
+        const PointKDNode2D queryPoint(0, positionDistribution(randomEngine), positionDistribution(randomEngine));
+        const float size(sizeDistribution(randomEngine));
+        const KDTreeBox searchBox(
+            queryPoint.dims[0] - size, queryPoint.dims[0] + size, queryPoint.dims[1] - size, queryPoint.dims[1] + size);
+
+        std::vector<float> distanceSquaredVector;
+        UIntVector inBox, inRadius;
+
+        for (const PointKDNode2D &point : pointList)
+        {
+            distanceSquaredVector.push_back(GetDistanceSquared(queryPoint, point));
+
+            if ((point.dims[0] >= searchBox.dimmin[0]) && (point.dims[0] <= searchBox.dimmax[0]) &&
+                (point.dims[1] >= searchBox.dimmin[1]) && (point.dims[1] <= searchBox.dimmax[1]))
+            {
+                inBox.push_back(point.data);
+            }
+
+            if (distanceSquaredVector.back() <= size * size)
+                inRadius.push_back(point.data);
+        }
+
+        PointKDNode2DList found;
+        kdTree.search(searchBox, found);
+
+        if (GetSortedData(found) != inBox)
+            ++nErrors;
+
+        found.clear();
+        kdTree.findNeighboursWithinRadius(queryPoint, size, found);
+
+        if (GetSortedData(found) != inRadius)
+            ++nErrors;
+
+        std::vector<float> sortedDistanceSquaredVector(distanceSquaredVector);
+        std::sort(sortedDistanceSquaredVector.begin(), sortedDistanceSquaredVector.end());
+
+        const PointKDNode2D *pNearestPoint(nullptr);
+        float nearestDistance(0.f);
+        kdTree.findNearestNeighbour(queryPoint, pNearestPoint, nearestDistance);
+
+        if (!pNearestPoint || (distanceSquaredVector.at(pNearestPoint->data) != sortedDistanceSquaredVector.front()))
+            ++nErrors;
+
+        const unsigned int k(kDistribution(randomEngine));
+        std::vector<const PointKDNode2D *> nearestPoints;
+        std::vector<float> nearestDistances;
+        kdTree.findKNearestNeighbours(queryPoint, k, nearestPoints, nearestDistances);
+
+        if ((nearestPoints.size() != std::min<size_t>(k, pointList.size())) || (nearestDistances.size() != nearestPoints.size()))
+        {
+            ++nErrors;
+        }
+        else
+        {
+            // ATTN Points at equal distances may be returned in any order, so only the distances are compared
+            for (unsigned int iNearest = 0; iNearest < nearestPoints.size(); ++iNearest)
+            {
+                if (distanceSquaredVector.at(nearestPoints.at(iNearest)->data) != sortedDistanceSquaredVector.at(iNearest))
+                    ++nErrors;
+            }
+        }
+
+        const KDTreeBoxVector searchBoxes{searchBox, KDTreeBox(queryPoint.dims[0], queryPoint.dims[0] + size, queryPoint.dims[1],
+                                                         queryPoint.dims[1] + size)};
+        std::vector<PointKDNode2DList> foundLists;
+        kdTree.search(searchBoxes, foundLists);
+
+        if (foundLists.size() != searchBoxes.size())
+        {
+            ++nErrors;
+            continue;
+        }
+
+        for (unsigned int iBox = 0; iBox < searchBoxes.size(); ++iBox)
+        {
+            PointKDNode2DList singleFound;
+            kdTree.search(searchBoxes.at(iBox), singleFound);
+
+            if (GetSortedData(foundLists.at(iBox)) != GetSortedData(singleFound))
+                ++nErrors;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float GetDistanceSquared(const PointKDNode2D &a, const PointKDNode2D &b)
+{
+    double distanceSquared(0.);
+
+    for (unsigned int iDim = 0; iDim < 2; ++iDim)
+    {
+        const double difference(a.dims[iDim] - b.dims[iDim]);
+        distanceSquared += difference * difference;
+    }
+
+    return static_cast<float>(distanceSquared);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+UIntVector GetSortedData(const PointKDNode2DList &pointList)
+{
+    UIntVector dataVector;
+
+    for (const PointKDNode2D &point : pointList)
+        dataVector.push_back(point.data);
+
+    std::sort(dataVector.begin(), dataVector.end());
+
+    return dataVector;
+}
+
+} // namespace
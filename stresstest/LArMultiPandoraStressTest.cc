@@ -0,0 +1,252 @@
+/**
+ *  @file   stresstest/LArMultiPandoraStressTest.cc
+ *
+ *  @brief  Implementation of the lar multi pandora stress test application, adding, querying and deleting pandora instances via the
+ *          multi pandora api from many threads at once and reporting any inconsistent results.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Pandora.h"
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
+
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace pandora;
+
+namespace
+{
+
+/**
+ *  @brief  Parameters class
+ */
+class Parameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Parameters();
+
+    unsigned int m_nThreads;    ///< The number of threads, each adding, querying and deleting its own pandora instances
+    unsigned int m_nIterations; ///< The number of iterations per thread
+    unsigned int m_nDaughters;  ///< The number of daughter pandora instances per primary pandora instance
+    unsigned int m_nLookups;    ///< The number of rounds of lookups per iteration
+};
+
+/**
+ *  @brief  Parse the command line arguments, setting the application parameters
+ *
+ *  @param  argc argument count
+ *  @param  argv argument vector
+ *  @param  parameters to receive the application parameters
+ *
+ *  @return whether the stress test should proceed
+ */
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters);
+
+/**
+ *  @brief  Print the list of configurable options
+ *
+ *  @return false, to force abort
+ */
+bool PrintOptions();
+
+/**
+ *  @brief  Repeatedly create a primary pandora instance with daughters, register them with the multi pandora api, check the results
+ *          of lookups and delete them again
+ *
+ *  @param  parameters the application parameters
+ *  @param  nErrors to count the inconsistent results
+ */
+void RunThread(const Parameters &parameters, std::atomic<unsigned int> &nErrors);
+
+/**
+ *  @brief  Check the results of lookups for a primary pandora instance and its daughters
+ *
+ *  @param  pPrimaryPandora the address of the primary pandora instance
+ *  @param  daughterList the daughter pandora instances, in volume id order
+ *
+ *  @return the number of inconsistent results
+ */
+unsigned int CheckLookups(const Pandora *const pPrimaryPandora, const PandoraInstanceList &daughterList);
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Parameters parameters;
+
+    if (!ParseCommandLine(argc, argv, parameters))
+        return 1;
+
+    std::atomic<unsigned int> nErrors(0);
+    std::vector<std::thread> threadVector;
+
+    for (unsigned int iThread = 0; iThread < parameters.m_nThreads; ++iThread)
+        threadVector.emplace_back(RunThread, std::cref(parameters), std::ref(nErrors));
+
+    for (std::thread &thread : threadVector)
+        thread.join();
+
+    if (!MultiPandoraApi::GetPandoraInstanceMap().empty())
+    {
+        std::cout << "LArMultiPandoraStressTest: pandora instances remain registered after deletion" << std::endl;
+        ++nErrors;
+    }
+
+    std::cout << "LArMultiPandoraStressTest: " << parameters.m_nThreads << " threads, " << parameters.m_nIterations << " iterations, "
+              << nErrors << " errors" << std::endl;
+
+    return ((0 == nErrors) ? 0 : 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+Parameters::Parameters() :
+    m_nThreads(16),
+    m_nIterations(100),
+    m_nDaughters(4),
+    m_nLookups(50)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters)
+{
+    int cOpt(0);
+
+    try
+    {
+        while ((cOpt = getopt(argc, argv, "t:n:d:l:h")) != -1)
+        {
+            switch (cOpt)
+            {
+                case 't':
+                    parameters.m_nThreads = std::stoul(optarg);
+                    break;
+                case 'n':
+                    parameters.m_nIterations = std::stoul(optarg);
+                    break;
+                case 'd':
+                    parameters.m_nDaughters = std::stoul(optarg);
+                    break;
+                case 'l':
+                    parameters.m_nLookups = std::stoul(optarg);
+                    break;
+                case 'h':
+                default:
+                    return PrintOptions();
+            }
+        }
+    }
+    catch (const std::logic_error &)
+    {
+        std::cout << "LArMultiPandoraStressTest: invalid numerical argument" << std::endl;
+        return PrintOptions();
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PrintOptions()
+{
+    const Parameters parameters;
+
+    std::cout << std::endl
+              << "./LArMultiPandoraStressTest " << std::endl
+              << "    -t NThreads             (optional) [default " << parameters.m_nThreads << "]" << std::endl
+              << "    -n NIterationsPerThread (optional) [default " << parameters.m_nIterations << "]" << std::endl
+              << "    -d NDaughtersPerPrimary (optional) [default " << parameters.m_nDaughters << "]" << std::endl
+              << "    -l NLookupsPerIteration (optional) [default " << parameters.m_nLookups << "]" << std::endl
+              << std::endl;
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RunThread(const Parameters &parameters, std::atomic<unsigned int> &nErrors)
+{
+    for (unsigned int iteration = 0; iteration < parameters.m_nIterations; ++iteration)
+    {
+        try
+        {
+            const Pandora *const pPrimaryPandora(new Pandora("LArStressTestPrimary"));
+            MultiPandoraApi::AddPrimaryPandoraInstance(pPrimaryPandora);
+
+            PandoraInstanceList daughterList;
+
+            for (unsigned int volumeId = 0; volumeId < parameters.m_nDaughters; ++volumeId)
+            {
+                const Pandora *const pDaughterPandora(new Pandora("LArStressTestDaughter" + std::to_string(volumeId)));
+                MultiPandoraApi::AddDaughterPandoraInstance(pPrimaryPandora, pDaughterPandora);
+                MultiPandoraApi::SetVolumeId(pDaughterPandora, volumeId);
+                daughterList.push_back(pDaughterPandora);
+            }
+
+            for (unsigned int iLookup = 0; iLookup < parameters.m_nLookups; ++iLookup)
+                nErrors += CheckLookups(pPrimaryPandora, daughterList);
+
+            // ATTN Addresses of deleted instances may be reused at once by other threads, so removal is only checked once all have finished
+            MultiPandoraApi::DeletePandoraInstances(pPrimaryPandora);
+        }
+        catch (const StatusCodeException &)
+        {
+            ++nErrors;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int CheckLookups(const Pandora *const pPrimaryPandora, const PandoraInstanceList &daughterList)
+{
+    unsigned int nErrors(0);
+
+    if (!MultiPandoraApi::IsPrimaryPandoraInstance(pPrimaryPandora))
+        ++nErrors;
+
+    if (MultiPandoraApi::GetDaughterPandoraInstanceList(pPrimaryPandora) != daughterList)
+        ++nErrors;
+
+    for (unsigned int volumeId = 0; volumeId < daughterList.size(); ++volumeId)
+    {
+        const Pandora *const pDaughterPandora(daughterList.at(volumeId));
+
+        if (MultiPandoraApi::IsPrimaryPandoraInstance(pDaughterPandora))
+            ++nErrors;
+
+        if (MultiPandoraApi::GetPrimaryPandoraInstance(pDaughterPandora) != pPrimaryPandora)
+            ++nErrors;
+
+        if (MultiPandoraApi::GetVolumeId(pDaughterPandora) != volumeId)
+            ++nErrors;
+
+        if (MultiPandoraApi::GetPandoraInstance(pPrimaryPandora, volumeId) != pDaughterPandora)
+            ++nErrors;
+    }
+
+    return nErrors;
+}
+
+} // namespace